@@ -1,25 +1,43 @@
 {
+  "variables": {
+    "core_dir%": "<!(node -p \"require('fs').existsSync('core/build-flags.json') ? 'core' : '../../core'\")"
+  },
   "targets": [
     {
       "target_name": "ethiopic_calendar",
       "sources": [
         "src/binding.cpp",
-        "src/core/ethiopic_calendar.c"
+        "<!@(node -p \"require('./<(core_dir)/build-flags.json').sources.map(s => '<(core_dir)/' + s).join(' ')\")"
       ],
       "include_dirs": [
         "<!@(node -p \"require('node-addon-api').include\")",
-        "src/core"
+        "<!@(node -p \"require('./<(core_dir)/build-flags.json').include_dirs.map(s => '<(core_dir)/' + s).join(' ')\")"
       ],
       "defines": [
         "NAPI_DISABLE_CPP_EXCEPTIONS"
       ],
       "cflags!": ["-fno-exceptions"],
       "cflags_cc!": ["-fno-exceptions"],
+      "cflags_c": [
+        "<!@(node -p \"f = require('./<(core_dir)/build-flags.json'); f.cflags.concat(f.optimize_cflags).join(' ')\")"
+      ],
+      "xcode_settings": {
+        "OTHER_CFLAGS": [
+          "<!@(node -p \"f = require('./<(core_dir)/build-flags.json'); f.cflags.concat(f.optimize_cflags).join(' ')\")"
+        ]
+      },
       "conditions": [
         ["OS=='win'", {
           "defines": [
             "_HAS_EXCEPTIONS=1"
-          ]
+          ],
+          "msvs_settings": {
+            "VCCLCompilerTool": {
+              "AdditionalOptions": [
+                "<!@(node -p \"require('./<(core_dir)/build-flags.json').msvc_cflags.join(' ')\")"
+              ]
+            }
+          }
         }]
       ]
     }
@@ -11,6 +11,19 @@ const {
     ETHIOPIAN_SEASONS 
 } = require('./lib/enhanced-date-converter');
 
+// Recently requested month grids, oldest first: a Map keeps insertion order,
+// so a hit is moved to the end and the first key is the one to evict
+const MONTH_GRID_CACHE_SIZE = 32;
+const monthGridCache = new Map();
+
+function freezeGrid(grid) {
+    for (const table of [grid.days, grid.jdns, grid.holidays]) {
+        table.forEach(Object.freeze);
+        Object.freeze(table);
+    }
+    return Object.freeze(grid);
+}
+
 class DateConverter {
     
     static ethiopicToGregorian(year, month, day, era = null) {
@@ -54,6 +67,106 @@ class DateConverter {
         return addon.getDayOfWeek(jdn);
     }
     
+    // Monday-Friday days in [startJdn, endJdn], minus holidays unless
+    // excludeHolidays is false; constant time for any range
+    static businessDaysBetween(startJdn, endJdn, excludeHolidays = true) {
+        return addon.businessDaysBetween(startJdn, endJdn, excludeHolidays);
+    }
+    
+    // Holiday lookups: one bit test in the core's per-year holiday bitmap
+    static isEthiopicHoliday(jdn) {
+        return addon.isEthiopicHoliday(jdn);
+    }
+    
+    // Holiday name on jdn, or null
+    static ethiopicHolidayName(jdn) {
+        return addon.ethiopicHolidayName(jdn);
+    }
+    
+    // { jdn, name } of the first holiday on or after jdn
+    static nextEthiopicHoliday(jdn) {
+        return addon.nextEthiopicHoliday(jdn);
+    }
+    
+    // { jdn, name } of the first holiday after jdn
+    static nextEthiopicHolidayAfter(jdn) {
+        return addon.nextEthiopicHolidayAfter(jdn);
+    }
+    
+    // [{ jdn, name }, ...] of the holidays in [startJdn, endJdn], in date order;
+    // a binary search in the core's sorted holiday index finds the first one
+    static ethiopicHolidaysInRange(startJdn, endJdn) {
+        return addon.ethiopicHolidaysInRange(startJdn, endJdn);
+    }
+    
+    // JDN of Ethiopian Orthodox Easter (Fasika) in an Ethiopian year
+    static ethiopicEaster(year) {
+        return addon.ethiopicEaster(year);
+    }
+    
+    // Replaces the Islamic holiday table with the "YYYY-MM-DD Name" lines of a
+    // text file; returns the number of holidays loaded
+    static loadIslamicHolidays(path) {
+        const count = addon.loadIslamicHolidays(path);
+        monthGridCache.clear();
+        return count;
+    }
+    
+    // 6x7 grid of a month filled by the core, weeks starting on Monday:
+    // { year, month, calendar, daysInMonth, firstWeekday, weeks, days, jdns, holidays }.
+    // Days are 0 outside the month. The last few months are kept in an LRU
+    // cache and returned frozen, so callers share them.
+    static monthGrid(year, month, calendar = 'ethiopic') {
+        if (calendar !== 'ethiopic' && calendar !== 'gregorian') {
+            throw new RangeError("calendar must be 'ethiopic' or 'gregorian'");
+        }
+        const key = `${calendar}:${year}:${month}`;
+        let grid = monthGridCache.get(key);
+        if (grid !== undefined) {
+            monthGridCache.delete(key);
+        } else {
+            grid = freezeGrid(addon.monthGrid(year, month, calendar === 'gregorian'));
+            if (monthGridCache.size >= MONTH_GRID_CACHE_SIZE) {
+                monthGridCache.delete(monthGridCache.keys().next().value);
+            }
+        }
+        monthGridCache.set(key, grid);
+        return grid;
+    }
+    
+    // Typed-array batch methods: Int32Array columns in, Int32Array columns out.
+    // Output arrays are optional; pass them to reuse buffers (or convert in place).
+    static gregorianToEthiopicBatch(years, months, days, outYears, outMonths, outDays) {
+        return addon.gregorianToEthiopicBatch(years, months, days, outYears, outMonths, outDays);
+    }
+    
+    static ethiopicToGregorianBatch(years, months, days, outYears, outMonths, outDays, era = null) {
+        return addon.ethiopicToGregorianBatch(years, months, days, outYears, outMonths, outDays, era);
+    }
+    
+    static gregorianToJDNBatch(years, months, days, outJdn) {
+        return addon.gregorianToJDNBatch(years, months, days, outJdn);
+    }
+    
+    static ethiopicToJDNBatch(years, months, days, outJdn, era = null) {
+        return addon.ethiopicToJDNBatch(years, months, days, outJdn, era);
+    }
+    
+    static jdnToGregorianBatch(jdn, outYears, outMonths, outDays) {
+        return addon.jdnToGregorianBatch(jdn, outYears, outMonths, outDays);
+    }
+    
+    static jdnToEthiopicBatch(jdn, outYears, outMonths, outDays, era = null) {
+        return addon.jdnToEthiopicBatch(jdn, outYears, outMonths, outDays, era);
+    }
+    
+    // Runs one of the batch methods above on the libuv threadpool; conversion is its
+    // name without the Batch suffix, e.g. 'gregorianToEthiopic'. Resolves with what the
+    // batch method returns. Inputs are copied on the call; outputs are filled at the end.
+    static convertBatchAsync(conversion, ...args) {
+        return addon.convertBatchAsync(conversion, ...args);
+    }
+    
     // Convenience methods for current dates
     static today() {
         return {
@@ -98,8 +211,10 @@ function generateCalendar(year, month, type = 'ethiopic') {
     }
 }
 
-function getBusinessDays(startDate, endDate) {
-    return CalendarUtils.getBusinessDaysBetween(startDate, endDate);
+// Weekdays between two dates (inclusive), counted in C in constant time;
+// pass excludeHolidays to also skip the Ethiopian holidays
+function getBusinessDays(startDate, endDate, excludeHolidays = false) {
+    return DateConverter.businessDaysBetween(startDate.getJDN(), endDate.getJDN(), excludeHolidays);
 }
 
 function getHolidays(year) {
@@ -132,6 +247,28 @@ module.exports = {
     jdnToEthiopic: DateConverter.jdnToEthiopic,
     jdnToGregorian: DateConverter.jdnToGregorian,
     getDayOfWeek: DateConverter.getDayOfWeek,
+    businessDaysBetween: DateConverter.businessDaysBetween,
+    
+    // Holiday lookups
+    isEthiopicHoliday: DateConverter.isEthiopicHoliday,
+    ethiopicHolidayName: DateConverter.ethiopicHolidayName,
+    nextEthiopicHoliday: DateConverter.nextEthiopicHoliday,
+    nextEthiopicHolidayAfter: DateConverter.nextEthiopicHolidayAfter,
+    ethiopicHolidaysInRange: DateConverter.ethiopicHolidaysInRange,
+    ethiopicEaster: DateConverter.ethiopicEaster,
+    loadIslamicHolidays: DateConverter.loadIslamicHolidays,
+    
+    // Month grids
+    monthGrid: DateConverter.monthGrid,
+    
+    // Typed-array batch conversions
+    gregorianToEthiopicBatch: DateConverter.gregorianToEthiopicBatch,
+    ethiopicToGregorianBatch: DateConverter.ethiopicToGregorianBatch,
+    gregorianToJDNBatch: DateConverter.gregorianToJDNBatch,
+    ethiopicToJDNBatch: DateConverter.ethiopicToJDNBatch,
+    jdnToGregorianBatch: DateConverter.jdnToGregorianBatch,
+    jdnToEthiopicBatch: DateConverter.jdnToEthiopicBatch,
+    convertBatchAsync: DateConverter.convertBatchAsync,
     
     // Calendar utilities
     CalendarUtils,
@@ -1,7 +1,14 @@
 /* Copyright (c) 2025 Abiy */
 
 #include <napi.h>
-#include "core/ethiopic_calendar.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ethiopic_calendar.h"
 
 
 Napi::Object CreateDateObject(Napi::Env env, const date_t& date) {
@@ -200,6 +207,598 @@ Napi::Value GetDayOfWeek(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, dayOfWeek);
 }
 
+// Wrapper for business_days_between
+Napi::Value BusinessDaysBetween(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Expected at least 2 arguments: startJdn, endJdn").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t startJdn = static_cast<int64_t>(info[0].As<Napi::Number>().DoubleValue());
+    int64_t endJdn = static_cast<int64_t>(info[1].As<Napi::Number>().DoubleValue());
+    bool excludeHolidays = info.Length() < 3 || info[2].IsUndefined() || info[2].ToBoolean().Value();
+    
+    return Napi::Number::New(env, static_cast<double>(business_days_between(startJdn, endJdn, excludeHolidays)));
+}
+
+// Holiday lookups, backed by the core's per-year holiday bitmaps
+
+static Napi::Value HolidayNameOrNull(Napi::Env env, int32_t id) {
+    if (id == ETHIOPIC_HOLIDAY_NONE) {
+        return env.Null();
+    }
+    return Napi::String::New(env, ethiopic_holiday_name(id));
+}
+
+// Wrapper for is_ethiopic_holiday
+Napi::Value IsEthiopicHoliday(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Expected 1 argument: jdn").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t jdn = static_cast<int64_t>(info[0].As<Napi::Number>().DoubleValue());
+    return Napi::Boolean::New(env, is_ethiopic_holiday(jdn));
+}
+
+// Wrapper for ethiopic_holiday_id / ethiopic_holiday_name: the name or null
+Napi::Value EthiopicHolidayName(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Expected 1 argument: jdn").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t jdn = static_cast<int64_t>(info[0].As<Napi::Number>().DoubleValue());
+    return HolidayNameOrNull(env, ethiopic_holiday_id(jdn));
+}
+
+// Wrapper for ethiopic_next_holiday: {jdn, name} of the first holiday on or after jdn
+Napi::Value NextEthiopicHoliday(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Expected 1 argument: jdn").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t jdn = static_cast<int64_t>(info[0].As<Napi::Number>().DoubleValue());
+    int32_t id = ETHIOPIC_HOLIDAY_NONE;
+    int64_t holiday = ethiopic_next_holiday(jdn, &id);
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("jdn", Napi::Number::New(env, static_cast<double>(holiday)));
+    result.Set("name", HolidayNameOrNull(env, id));
+    return result;
+}
+
+// Wrapper for ethiopic_next_holiday_after: {jdn, name} of the first holiday after jdn
+Napi::Value NextEthiopicHolidayAfter(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Expected 1 argument: jdn").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t jdn = static_cast<int64_t>(info[0].As<Napi::Number>().DoubleValue());
+    int32_t id = ETHIOPIC_HOLIDAY_NONE;
+    int64_t holiday = ethiopic_next_holiday_after(jdn, &id);
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("jdn", Napi::Number::New(env, static_cast<double>(holiday)));
+    result.Set("name", HolidayNameOrNull(env, id));
+    return result;
+}
+
+// Wrapper for ethiopic_holidays_in_range: [{jdn, name}, ...] of the holidays of a closed JDN range
+Napi::Value EthiopicHolidaysInRange(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Expected 2 arguments: startJdn, endJdn").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t start_jdn = static_cast<int64_t>(info[0].As<Napi::Number>().DoubleValue());
+    int64_t end_jdn = static_cast<int64_t>(info[1].As<Napi::Number>().DoubleValue());
+    Napi::Array result = Napi::Array::New(env);
+    uint32_t length = 0;
+    ethiopic_dated_holiday_t chunk[64];
+    size_t written;
+    
+    // A full chunk may be followed by more holidays, from the day after its last one
+    do {
+        written = ethiopic_holidays_in_range(start_jdn, end_jdn, chunk, 64);
+        for (size_t i = 0; i < written; i++) {
+            Napi::Object holiday = Napi::Object::New(env);
+            holiday.Set("jdn", Napi::Number::New(env, static_cast<double>(chunk[i].jdn)));
+            holiday.Set("name", HolidayNameOrNull(env, chunk[i].id));
+            result.Set(length++, holiday);
+        }
+        if (written > 0) {
+            start_jdn = chunk[written - 1].jdn + 1;
+        }
+    } while (written == 64);
+    return result;
+}
+
+// Wrapper for ethiopic_easter
+Napi::Value EthiopicEaster(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Expected 1 argument: year").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int32_t year = info[0].As<Napi::Number>().Int32Value();
+    return Napi::Number::New(env, static_cast<double>(ethiopic_easter(year)));
+}
+
+// Wrapper for ethiopic_load_islamic_holidays: the number of holidays loaded
+Napi::Value LoadIslamicHolidays(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "Expected 1 argument: path").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string path = info[0].As<Napi::String>().Utf8Value();
+    int32_t result = ethiopic_load_islamic_holidays(path.c_str());
+    
+    if (result == ETHIOPIC_HOLIDAY_ERROR_IO) {
+        Napi::Error::New(env, "Cannot read Islamic holiday file: " + path).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (result < 0) {
+        Napi::Error::New(env, "Invalid Islamic holiday file: " + path).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    return Napi::Number::New(env, result);
+}
+
+// Copies one 6x7 table of an ethiopic_month_grid_t into rows of JavaScript values
+template <typename Cell, typename Convert>
+static Napi::Array GridRows(Napi::Env env, const Cell (&cells)[ETHIOPIC_GRID_WEEKS][7], Convert convert) {
+    Napi::Array rows = Napi::Array::New(env, ETHIOPIC_GRID_WEEKS);
+    for (uint32_t week = 0; week < ETHIOPIC_GRID_WEEKS; week++) {
+        Napi::Array row = Napi::Array::New(env, 7);
+        for (uint32_t weekday = 0; weekday < 7; weekday++) {
+            row.Set(weekday, convert(cells[week][weekday]));
+        }
+        rows.Set(week, row);
+    }
+    return rows;
+}
+
+// Wrapper for ethiopic_month_grid: the 6x7 grid of a month, weeks starting on Monday
+Napi::Value MonthGrid(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: year, month, gregorian").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int32_t year = info[0].As<Napi::Number>().Int32Value();
+    int32_t month = info[1].As<Napi::Number>().Int32Value();
+    bool gregorian = info[2].ToBoolean().Value();
+    ethiopic_month_grid_t grid;
+    
+    if (!ethiopic_month_grid(gregorian ? ETHIOPIC_GRID_GREGORIAN : ETHIOPIC_GRID_ETHIOPIC, year, month, &grid)) {
+        Napi::RangeError::New(env, gregorian ? "Invalid Gregorian month" : "Invalid Ethiopian month")
+            .ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("year", Napi::Number::New(env, year));
+    result.Set("month", Napi::Number::New(env, month));
+    result.Set("calendar", Napi::String::New(env, gregorian ? "gregorian" : "ethiopic"));
+    result.Set("daysInMonth", Napi::Number::New(env, grid.days_in_month));
+    result.Set("firstWeekday", Napi::Number::New(env, grid.first_weekday));
+    result.Set("weeks", Napi::Number::New(env, grid.weeks));
+    result.Set("days", GridRows(env, grid.day, [env](uint8_t day) {
+        return Napi::Number::New(env, day);
+    }));
+    result.Set("jdns", GridRows(env, grid.jdn, [env](int64_t jdn) {
+        return Napi::Number::New(env, static_cast<double>(jdn));
+    }));
+    result.Set("holidays", GridRows(env, grid.holiday, [env](int8_t id) {
+        return HolidayNameOrNull(env, id);
+    }));
+    return result;
+}
+
+// Typed-array batch conversions
+//
+// Each function reads Int32Array columns and writes Int32Array columns, converting
+// chunk by chunk through the core's SoA functions. Output arrays may be supplied by
+// the caller (and may be the input arrays themselves); omitted ones are allocated
+// once per call. No JS value is created per element.
+
+static const size_t kBatchChunk = 256;
+static const size_t kAnyLength = SIZE_MAX;
+static const char* const kColumnNames[3] = {"year", "month", "day"};
+
+enum class BatchKind {
+    GregorianToEthiopic,
+    EthiopicToGregorian,
+    GregorianToJDN,
+    EthiopicToJDN,
+    JDNToGregorian,
+    JDNToEthiopic
+};
+
+// One conversion over columns: three date columns or one JDN column on each side
+struct BatchJob {
+    BatchKind kind;
+    const int32_t* in[3];
+    int32_t* out[3];
+    size_t length;
+    int64_t era;
+    bool detect_era;
+};
+
+static size_t InputColumns(BatchKind kind) {
+    return (kind == BatchKind::JDNToGregorian || kind == BatchKind::JDNToEthiopic) ? 1 : 3;
+}
+
+static size_t OutputColumns(BatchKind kind) {
+    return (kind == BatchKind::GregorianToJDN || kind == BatchKind::EthiopicToJDN) ? 1 : 3;
+}
+
+static bool TakesEra(BatchKind kind) {
+    return kind == BatchKind::EthiopicToGregorian || kind == BatchKind::EthiopicToJDN ||
+           kind == BatchKind::JDNToEthiopic;
+}
+
+// Converts elements [begin, end) of a job; touches no JS values, so it may run on any thread
+static void RunBatch(const BatchJob& job, size_t begin, size_t end) {
+    const int32_t* const* in = job.in;
+    int32_t* const* out = job.out;
+    int64_t jdn[kBatchChunk];
+    bool valid[kBatchChunk];
+    
+    for (size_t start = begin; start < end; start += kBatchChunk) {
+        size_t count = std::min(kBatchChunk, end - start);
+        
+        switch (job.kind) {
+        case BatchKind::GregorianToEthiopic:
+            // Invalid Gregorian dates produce 0/0/0
+            for (size_t i = 0; i < count; i++) {
+                valid[i] = is_valid_gregorian_date(in[0][start + i], in[1][start + i], in[2][start + i]);
+            }
+            gregorian_to_jdn_soa(in[0] + start, in[1] + start, in[2] + start, jdn, count);
+            for (size_t i = 0; i < count; i++) {
+                date_t date = jdn_to_ethiopic_fast(jdn[i], guess_era(jdn[i]));
+                out[0][start + i] = valid[i] ? date.year : 0;
+                out[1][start + i] = valid[i] ? date.month : 0;
+                out[2][start + i] = valid[i] ? date.day : 0;
+            }
+            break;
+            
+        case BatchKind::EthiopicToGregorian:
+            // Without an era each date's era is detected as in ethiopicToGregorian;
+            // invalid Ethiopian dates produce 0/0/0
+            for (size_t i = 0; i < count; i++) {
+                valid[i] = is_valid_ethiopic_date(in[0][start + i], in[1][start + i], in[2][start + i]);
+            }
+            ethiopic_to_jdn_soa(in[0] + start, in[1] + start, in[2] + start, jdn, count, job.era);
+            if (job.detect_era) {
+                for (size_t i = 0; i < count; i++) {
+                    if (guess_era(jdn[i]) != JD_EPOCH_OFFSET_AMETE_MIHRET) {
+                        jdn[i] += JD_EPOCH_OFFSET_AMETE_ALEM - JD_EPOCH_OFFSET_AMETE_MIHRET;
+                    }
+                }
+            }
+            jdn_to_gregorian_soa(jdn, out[0] + start, out[1] + start, out[2] + start, count);
+            for (size_t i = 0; i < count; i++) {
+                if (!valid[i]) {
+                    out[0][start + i] = out[1][start + i] = out[2][start + i] = 0;
+                }
+            }
+            break;
+            
+        case BatchKind::GregorianToJDN:
+            gregorian_to_jdn_soa(in[0] + start, in[1] + start, in[2] + start, jdn, count);
+            for (size_t i = 0; i < count; i++) {
+                out[0][start + i] = static_cast<int32_t>(jdn[i]);
+            }
+            break;
+            
+        case BatchKind::EthiopicToJDN:
+            ethiopic_to_jdn_soa(in[0] + start, in[1] + start, in[2] + start, jdn, count, job.era);
+            for (size_t i = 0; i < count; i++) {
+                out[0][start + i] = static_cast<int32_t>(jdn[i]);
+            }
+            break;
+            
+        case BatchKind::JDNToGregorian:
+            std::copy(in[0] + start, in[0] + start + count, jdn);
+            jdn_to_gregorian_soa(jdn, out[0] + start, out[1] + start, out[2] + start, count);
+            break;
+            
+        case BatchKind::JDNToEthiopic:
+            std::copy(in[0] + start, in[0] + start + count, jdn);
+            jdn_to_ethiopic_soa(jdn, out[0] + start, out[1] + start, out[2] + start, count, job.era);
+            break;
+        }
+    }
+}
+
+static bool IsMissing(const Napi::CallbackInfo& info, size_t index) {
+    return info.Length() <= index || info[index].IsUndefined() || info[index].IsNull();
+}
+
+// Returns the data of info[index] if it is an Int32Array of the expected length
+// (any length when length is kAnyLength, which is then set), or throws
+static int32_t* GetInt32Array(const Napi::CallbackInfo& info, size_t index, size_t& length) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() <= index || !info[index].IsTypedArray() ||
+        info[index].As<Napi::TypedArray>().TypedArrayType() != napi_int32_array) {
+        Napi::TypeError::New(env, "Expected an Int32Array as argument " + std::to_string(index + 1))
+            .ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    
+    Napi::Int32Array array = info[index].As<Napi::Int32Array>();
+    if (length == kAnyLength) {
+        length = array.ElementLength();
+    } else if (array.ElementLength() != length) {
+        Napi::RangeError::New(env, "All arrays must have the same length")
+            .ThrowAsJavaScriptException();
+        return nullptr;
+    }
+    return array.Data();
+}
+
+// Reads the arguments of a batch function starting at info[first]: input columns, optional
+// output columns, optional era. Sets result to the value the function returns, and appends
+// every array the job reads or writes to arrays.
+static bool ParseBatchArgs(const Napi::CallbackInfo& info, BatchKind kind, size_t first,
+                           BatchJob& job, Napi::Value& result, std::vector<Napi::Value>& arrays) {
+    Napi::Env env = info.Env();
+    size_t inputs = InputColumns(kind);
+    size_t outputs = OutputColumns(kind);
+    
+    job.kind = kind;
+    job.length = kAnyLength;
+    for (size_t k = 0; k < inputs; k++) {
+        job.in[k] = GetInt32Array(info, first + k, job.length);
+        if (job.in[k] == nullptr) {
+            return false;
+        }
+        arrays.push_back(info[first + k]);
+    }
+    
+    Napi::Object columns = Napi::Object::New(env);
+    for (size_t k = 0; k < outputs; k++) {
+        size_t index = first + inputs + k;
+        Napi::Int32Array array;
+        if (IsMissing(info, index)) {
+            array = Napi::Int32Array::New(env, job.length);
+        } else if (GetInt32Array(info, index, job.length) != nullptr) {
+            array = info[index].As<Napi::Int32Array>();
+        } else {
+            return false;
+        }
+        job.out[k] = array.Data();
+        arrays.push_back(array);
+        if (outputs == 1) {
+            result = array;
+        } else {
+            columns.Set(kColumnNames[k], array);
+        }
+    }
+    if (outputs > 1) {
+        result = columns;
+    }
+    
+    size_t era_index = first + inputs + outputs;
+    job.detect_era = (kind == BatchKind::EthiopicToGregorian) && IsMissing(info, era_index);
+    job.era = (TakesEra(kind) && !IsMissing(info, era_index))
+              ? info[era_index].As<Napi::Number>().Int64Value()
+              : JD_EPOCH_OFFSET_AMETE_MIHRET;
+    return true;
+}
+
+static Napi::Value ConvertBatch(const Napi::CallbackInfo& info, BatchKind kind) {
+    BatchJob job;
+    Napi::Value result;
+    std::vector<Napi::Value> arrays;
+    
+    if (!ParseBatchArgs(info, kind, 0, job, result, arrays)) {
+        return info.Env().Null();
+    }
+    RunBatch(job, 0, job.length);
+    return result;
+}
+
+// gregorianToEthiopicBatch(years, months, days, outYears?, outMonths?, outDays?)
+Napi::Value GregorianToEthiopicBatch(const Napi::CallbackInfo& info) {
+    return ConvertBatch(info, BatchKind::GregorianToEthiopic);
+}
+
+// ethiopicToGregorianBatch(years, months, days, outYears?, outMonths?, outDays?, era?)
+Napi::Value EthiopicToGregorianBatch(const Napi::CallbackInfo& info) {
+    return ConvertBatch(info, BatchKind::EthiopicToGregorian);
+}
+
+// gregorianToJDNBatch(years, months, days, outJdn?)
+Napi::Value GregorianToJDNBatch(const Napi::CallbackInfo& info) {
+    return ConvertBatch(info, BatchKind::GregorianToJDN);
+}
+
+// ethiopicToJDNBatch(years, months, days, outJdn?, era?)
+Napi::Value EthiopicToJDNBatch(const Napi::CallbackInfo& info) {
+    return ConvertBatch(info, BatchKind::EthiopicToJDN);
+}
+
+// jdnToGregorianBatch(jdn, outYears?, outMonths?, outDays?)
+Napi::Value JDNToGregorianBatch(const Napi::CallbackInfo& info) {
+    return ConvertBatch(info, BatchKind::JDNToGregorian);
+}
+
+// jdnToEthiopicBatch(jdn, outYears?, outMonths?, outDays?, era?)
+Napi::Value JDNToEthiopicBatch(const Napi::CallbackInfo& info) {
+    return ConvertBatch(info, BatchKind::JDNToEthiopic);
+}
+
+
+// Asynchronous batch conversion
+//
+// convertBatchAsync(conversion, ...) takes the name of a batch function followed by its
+// arguments and returns a promise for its result. The work is split into slices, each run
+// by its own Napi::AsyncWorker on the libuv threadpool, and the promise resolves on the
+// main thread once every slice is done. The workers read copies of the inputs and write
+// into their own columns, which are copied into the output arrays on the main thread at
+// the end; JS may therefore change, transfer or detach any of the arrays meanwhile. The
+// promise is rejected if an output array has been detached by then.
+
+// Slices smaller than this are not worth a trip through the threadpool
+static const size_t kMinAsyncSlice = 1 << 16;
+
+struct AsyncBatchState {
+    explicit AsyncBatchState(Napi::Env env) : deferred(Napi::Promise::Deferred::New(env)) {}
+    
+    BatchJob job;                   // reads and writes columns only
+    std::vector<int32_t> columns;   // the input columns, then the output columns
+    Napi::Promise::Deferred deferred;
+    Napi::Reference<Napi::Value> result;
+    std::vector<Napi::Reference<Napi::Int32Array>> outputs;
+    size_t pending = 0;
+};
+
+// Copies the converted columns into the output arrays and resolves, or rejects if one of
+// them was detached while the workers ran
+static void SettleAsyncBatch(Napi::Env env, AsyncBatchState& state) {
+    size_t length = state.job.length;
+    std::vector<Napi::Int32Array> outputs;
+    
+    for (const auto& output : state.outputs) {
+        Napi::Int32Array array = output.Value();
+        if (array.ElementLength() != length) {
+            state.deferred.Reject(Napi::TypeError::New(env,
+                "An output array was detached before the conversion finished").Value());
+            return;
+        }
+        outputs.push_back(array);
+    }
+    for (size_t k = 0; k < outputs.size(); k++) {
+        std::memcpy(outputs[k].Data(), state.job.out[k], length * sizeof(int32_t));
+    }
+    state.deferred.Resolve(state.result.Value());
+}
+
+class BatchWorker : public Napi::AsyncWorker {
+public:
+    BatchWorker(Napi::Env env, std::shared_ptr<AsyncBatchState> state, size_t begin, size_t end)
+        : Napi::AsyncWorker(env), state_(std::move(state)), begin_(begin), end_(end) {}
+    
+    void Execute() override {
+        RunBatch(state_->job, begin_, end_);
+    }
+    
+    void OnOK() override {
+        // Completion callbacks run on the main thread, one at a time
+        if (--state_->pending == 0) {
+            SettleAsyncBatch(Env(), *state_);
+        }
+    }
+    
+private:
+    std::shared_ptr<AsyncBatchState> state_;
+    size_t begin_;
+    size_t end_;
+};
+
+static size_t ThreadpoolSize() {
+    const char* value = std::getenv("UV_THREADPOOL_SIZE");
+    long size = (value != nullptr) ? std::strtol(value, nullptr, 10) : 0;
+    return (size > 0) ? static_cast<size_t>(size) : 4;
+}
+
+Napi::Value ConvertBatchAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    static const struct {
+        const char* name;
+        BatchKind kind;
+    } kinds[] = {
+        {"gregorianToEthiopic", BatchKind::GregorianToEthiopic},
+        {"ethiopicToGregorian", BatchKind::EthiopicToGregorian},
+        {"gregorianToJDN", BatchKind::GregorianToJDN},
+        {"ethiopicToJDN", BatchKind::EthiopicToJDN},
+        {"jdnToGregorian", BatchKind::JDNToGregorian},
+        {"jdnToEthiopic", BatchKind::JDNToEthiopic},
+    };
+    
+    auto state = std::make_shared<AsyncBatchState>(env);
+    Napi::Promise promise = state->deferred.Promise();
+    
+    const BatchKind* kind = nullptr;
+    if (info.Length() > 0 && info[0].IsString()) {
+        std::string name = info[0].As<Napi::String>().Utf8Value();
+        for (const auto& entry : kinds) {
+            if (name == entry.name) {
+                kind = &entry.kind;
+            }
+        }
+    }
+    if (kind == nullptr) {
+        state->deferred.Reject(Napi::TypeError::New(env,
+            "Expected a conversion name such as 'gregorianToEthiopic' as argument 1").Value());
+        return promise;
+    }
+    
+    Napi::Value result;
+    std::vector<Napi::Value> arrays;
+    if (!ParseBatchArgs(info, *kind, 1, state->job, result, arrays)) {
+        // Turn the pending argument error into a rejection
+        Napi::Error error = env.GetAndClearPendingException();
+        state->deferred.Reject(error.Value());
+        return promise;
+    }
+    
+    size_t length = state->job.length;
+    if (length == 0) {
+        state->deferred.Resolve(result);
+        return promise;
+    }
+    
+    // Point the job at worker-owned copies; arrays holds the inputs, then the outputs
+    BatchJob& job = state->job;
+    size_t inputs = InputColumns(*kind);
+    state->columns.resize(arrays.size() * length);
+    for (size_t k = 0; k < arrays.size(); k++) {
+        int32_t* column = state->columns.data() + k * length;
+        if (k < inputs) {
+            std::memcpy(column, job.in[k], length * sizeof(int32_t));
+            job.in[k] = column;
+        } else {
+            job.out[k - inputs] = column;
+            state->outputs.push_back(Napi::Persistent(arrays[k].As<Napi::Int32Array>()));
+        }
+    }
+    state->result = Napi::Persistent(result);
+    
+    size_t slices = std::min(ThreadpoolSize(), (length + kMinAsyncSlice - 1) / kMinAsyncSlice);
+    size_t slice_length = (length + slices - 1) / slices;
+    state->pending = (length + slice_length - 1) / slice_length;
+    for (size_t begin = 0; begin < length; begin += slice_length) {
+        size_t end = std::min(length, begin + slice_length);
+        (new BatchWorker(env, state, begin, end))->Queue();
+    }
+    return promise;
+}
 
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("ethiopicToGregorian", Napi::Function::New(env, EthiopicToGregorian));
@@ -214,6 +813,24 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("jdnToEthiopic", Napi::Function::New(env, JDNToEthiopic));
     exports.Set("jdnToGregorian", Napi::Function::New(env, JDNToGregorian));
     exports.Set("getDayOfWeek", Napi::Function::New(env, GetDayOfWeek));
+    exports.Set("businessDaysBetween", Napi::Function::New(env, BusinessDaysBetween));
+    exports.Set("isEthiopicHoliday", Napi::Function::New(env, IsEthiopicHoliday));
+    exports.Set("ethiopicHolidayName", Napi::Function::New(env, EthiopicHolidayName));
+    exports.Set("nextEthiopicHoliday", Napi::Function::New(env, NextEthiopicHoliday));
+    exports.Set("nextEthiopicHolidayAfter", Napi::Function::New(env, NextEthiopicHolidayAfter));
+    exports.Set("ethiopicHolidaysInRange", Napi::Function::New(env, EthiopicHolidaysInRange));
+    exports.Set("ethiopicEaster", Napi::Function::New(env, EthiopicEaster));
+    exports.Set("loadIslamicHolidays", Napi::Function::New(env, LoadIslamicHolidays));
+    exports.Set("monthGrid", Napi::Function::New(env, MonthGrid));
+
+    // Typed-array batch functions
+    exports.Set("gregorianToEthiopicBatch", Napi::Function::New(env, GregorianToEthiopicBatch));
+    exports.Set("ethiopicToGregorianBatch", Napi::Function::New(env, EthiopicToGregorianBatch));
+    exports.Set("gregorianToJDNBatch", Napi::Function::New(env, GregorianToJDNBatch));
+    exports.Set("ethiopicToJDNBatch", Napi::Function::New(env, EthiopicToJDNBatch));
+    exports.Set("jdnToGregorianBatch", Napi::Function::New(env, JDNToGregorianBatch));
+    exports.Set("jdnToEthiopicBatch", Napi::Function::New(env, JDNToEthiopicBatch));
+    exports.Set("convertBatchAsync", Napi::Function::New(env, ConvertBatchAsync));
 
     exports.Set("JD_EPOCH_OFFSET_AMETE_ALEM", 
                 Napi::Number::New(env, JD_EPOCH_OFFSET_AMETE_ALEM));
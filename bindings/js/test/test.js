@@ -1,8 +1,9 @@
 /* Copyright (c) 2025 Abiy */
 
+const { MessageChannel } = require('worker_threads');
 const { DateConverter, ethiopicToGregorian, gregorianToEthiopic } = require('../index');
 
-function runTests() {
+async function runTests() {
     console.log('Testing Ethiopian Date Converter...\n');
     
     const tests = [
@@ -138,6 +139,384 @@ function runTests() {
         }
     }
     
+    console.log('=== Typed-Array Batch Tests ===');
+    const count = 1000;
+    const years = new Int32Array(count);
+    const months = new Int32Array(count);
+    const days = new Int32Array(count);
+    const startJdn = DateConverter.gregorianToJDN(2020, 1, 1);
+    for (let i = 0; i < count; i++) {
+        const date = DateConverter.jdnToGregorian(startJdn + 7 * i);
+        years[i] = date.year;
+        months[i] = date.month;
+        days[i] = date.day;
+    }
+    
+    const batchTests = [
+        {
+            name: 'gregorianToEthiopicBatch matches gregorianToEthiopic',
+            func: () => {
+                const out = DateConverter.gregorianToEthiopicBatch(years, months, days);
+                return Array.from(years).every((year, i) => {
+                    const expected = gregorianToEthiopic(year, months[i], days[i]);
+                    return out.year[i] === expected.year && out.month[i] === expected.month &&
+                           out.day[i] === expected.day;
+                });
+            },
+            expected: true
+        },
+        {
+            name: 'ethiopicToGregorianBatch round-trips in place',
+            func: () => {
+                const y = years.slice(), m = months.slice(), d = days.slice();
+                DateConverter.gregorianToEthiopicBatch(y, m, d, y, m, d);
+                DateConverter.ethiopicToGregorianBatch(y, m, d, y, m, d);
+                return y.every((year, i) => year === years[i] && m[i] === months[i] && d[i] === days[i]);
+            },
+            expected: true
+        },
+        {
+            name: 'gregorianToJDNBatch and jdnToGregorianBatch agree',
+            func: () => {
+                const jdn = DateConverter.gregorianToJDNBatch(years, months, days);
+                const out = DateConverter.jdnToGregorianBatch(jdn);
+                return jdn[1] - jdn[0] === 7 &&
+                       out.year.every((year, i) => year === years[i] && out.day[i] === days[i]);
+            },
+            expected: true
+        },
+        {
+            name: 'ethiopicToJDNBatch and jdnToEthiopicBatch agree',
+            func: () => {
+                const jdn = DateConverter.gregorianToJDNBatch(years, months, days);
+                const eth = DateConverter.jdnToEthiopicBatch(jdn);
+                const back = DateConverter.ethiopicToJDNBatch(eth.year, eth.month, eth.day);
+                return back.every((value, i) => value === jdn[i]);
+            },
+            expected: true
+        },
+        {
+            name: 'Invalid dates convert to zeros',
+            func: () => {
+                const out = DateConverter.gregorianToEthiopicBatch(
+                    Int32Array.of(2023), Int32Array.of(2), Int32Array.of(29));
+                return out.year[0] === 0 && out.month[0] === 0 && out.day[0] === 0;
+            },
+            expected: true
+        },
+        {
+            name: 'Mismatched lengths throw a RangeError',
+            func: () => {
+                try {
+                    DateConverter.gregorianToJDNBatch(new Int32Array(2), new Int32Array(2), new Int32Array(3));
+                    return false;
+                } catch (error) {
+                    return error instanceof RangeError;
+                }
+            },
+            expected: true
+        }
+    ];
+    
+    for (const test of batchTests) {
+        try {
+            const result = test.func();
+            const match = result === test.expected;
+            
+            console.log(`${match ? 'PASS' : 'FAIL'} ${test.name}`);
+            
+            if (match) passed++;
+            total++;
+        } catch (error) {
+            console.log(`FAIL ${test.name} - Error: ${error.message}`);
+            total++;
+        }
+    }
+    console.log();
+    
+    console.log('=== Business Day Tests ===');
+    // Meskerem 2017 runs from Wednesday 2024-09-11 to Thursday 2024-10-10
+    const meskeremStart = DateConverter.ethiopicToJDN(2017, 1, 1);
+    const meskeremEnd = DateConverter.ethiopicToJDN(2017, 1, 30);
+    const businessDayTests = [
+        {
+            name: 'Weekdays of Meskerem 2017',
+            func: () => DateConverter.businessDaysBetween(meskeremStart, meskeremEnd, false),
+            expected: 22
+        },
+        {
+            name: 'Weekdays minus New Year and Meskel',
+            func: () => DateConverter.businessDaysBetween(meskeremStart, meskeremEnd),
+            expected: 20
+        },
+        {
+            name: 'Range given in reverse order',
+            func: () => DateConverter.businessDaysBetween(meskeremEnd, meskeremStart),
+            expected: 20
+        },
+        {
+            name: 'Ten-year range matches a day-by-day count',
+            func: () => {
+                const holidays = new Set(['1-1', '1-17', '4-29', '5-11', '6-23']);
+                // Palm Sunday and Easter fall on Sundays; Good Friday is the weekday to skip
+                const goodFridays = new Set();
+                for (let year = 2017; year <= 2027; year++) {
+                    goodFridays.add(DateConverter.ethiopicEaster(year) - 2);
+                }
+                const end = meskeremStart + 3652;
+                let count = 0;
+                for (let jdn = meskeremStart; jdn <= end; jdn++) {
+                    const date = DateConverter.jdnToEthiopic(jdn);
+                    if (jdn % 7 < 5 && !goodFridays.has(jdn) &&
+                        !holidays.has(`${date.month}-${date.day}`)) count++;
+                }
+                return DateConverter.businessDaysBetween(meskeremStart, end) === count;
+            },
+            expected: true
+        }
+    ];
+    
+    for (const test of businessDayTests) {
+        try {
+            const result = test.func();
+            const match = result === test.expected;
+            
+            console.log(`${match ? 'PASS' : 'FAIL'} ${test.name}`);
+            
+            if (match) passed++;
+            total++;
+        } catch (error) {
+            console.log(`FAIL ${test.name} - Error: ${error.message}`);
+            total++;
+        }
+    }
+    console.log();
+    
+    console.log('=== Holiday Tests ===');
+    const genna = DateConverter.ethiopicToJDN(2017, 4, 29);
+    const holidayTests = [
+        {
+            name: 'Genna is a holiday',
+            func: () => DateConverter.isEthiopicHoliday(genna) && !DateConverter.isEthiopicHoliday(genna - 1),
+            expected: true
+        },
+        {
+            name: 'Holiday name of Genna',
+            func: () => DateConverter.ethiopicHolidayName(genna),
+            expected: 'Ethiopian Christmas'
+        },
+        {
+            name: 'No holiday name on ordinary days',
+            func: () => DateConverter.ethiopicHolidayName(genna + 1),
+            expected: null
+        },
+        {
+            name: 'Next holiday after Genna is Timkat',
+            func: () => {
+                const next = DateConverter.nextEthiopicHoliday(genna + 1);
+                return `${next.jdn - genna} ${next.name}`;
+            },
+            expected: '12 Epiphany (Timkat)'
+        },
+        {
+            name: 'Next holiday on a holiday is that holiday',
+            func: () => DateConverter.nextEthiopicHoliday(genna).jdn - genna,
+            expected: 0
+        },
+        {
+            name: 'Next holiday after Genna, from Genna itself',
+            func: () => DateConverter.nextEthiopicHolidayAfter(genna).name,
+            expected: 'Epiphany (Timkat)'
+        },
+        {
+            name: 'Holidays of Meskerem 2017',
+            func: () => DateConverter.ethiopicHolidaysInRange(DateConverter.ethiopicToJDN(2017, 1, 1),
+                                                              DateConverter.ethiopicToJDN(2017, 1, 30))
+                .map(holiday => holiday.name).join(', '),
+            expected: 'Ethiopian New Year, Finding of the True Cross'
+        },
+        {
+            name: 'Holidays of a reversed range',
+            func: () => DateConverter.ethiopicHolidaysInRange(genna, genna - 30).length,
+            expected: 0
+        },
+        {
+            name: 'Fasika 2017 is 20 April 2025',
+            func: () => DateConverter.ethiopicEaster(2017) === DateConverter.gregorianToJDN(2025, 4, 20),
+            expected: true
+        },
+        {
+            name: 'Good Friday is a holiday',
+            func: () => DateConverter.ethiopicHolidayName(DateConverter.ethiopicEaster(2017) - 2),
+            expected: 'Good Friday'
+        },
+        {
+            name: 'Islamic holidays from a data file',
+            func: () => {
+                const fs = require('fs');
+                const os = require('os');
+                const path = require('path');
+                const file = path.join(os.tmpdir(), `islamic-holidays-${process.pid}.txt`);
+                const eid = DateConverter.gregorianToJDN(2025, 3, 30);
+                try {
+                    fs.writeFileSync(file, '# test\n2025-03-30 Eid al-Fitr\n');
+                    const loaded = DateConverter.loadIslamicHolidays(file);
+                    const name = DateConverter.ethiopicHolidayName(eid);
+                    fs.writeFileSync(file, '');
+                    DateConverter.loadIslamicHolidays(file);
+                    return `${loaded} ${name} ${DateConverter.isEthiopicHoliday(eid)}`;
+                } finally {
+                    fs.unlinkSync(file);
+                }
+            },
+            expected: '1 Eid al-Fitr false'
+        },
+        {
+            name: 'Month grid of Meskerem 2017',
+            func: () => {
+                const grid = DateConverter.monthGrid(2017, 1);
+                return `${grid.daysInMonth} ${grid.firstWeekday} ${grid.weeks} ` +
+                    `${grid.days[0].join(',')} ${grid.holidays[0][2]} ${grid.holidays[2][4]}`;
+            },
+            expected: '30 2 5 0,0,1,2,3,4,5 Ethiopian New Year Finding of the True Cross'
+        },
+        {
+            name: 'Month grid JDNs are consecutive from Monday',
+            func: () => {
+                const grid = DateConverter.monthGrid(2021, 2, 'gregorian');
+                const start = DateConverter.gregorianToJDN(2021, 2, 1);
+                return grid.weeks === 4 && grid.jdns.flat().every((jdn, cell) => jdn === start + cell);
+            },
+            expected: true
+        },
+        {
+            name: 'Month grid of Pagume in a leap year',
+            func: () => DateConverter.monthGrid(2015, 13).daysInMonth,
+            expected: 6
+        },
+        {
+            name: 'Month grids are cached and frozen',
+            func: () => {
+                const grid = DateConverter.monthGrid(2017, 1);
+                return grid === DateConverter.monthGrid(2017, 1) && Object.isFrozen(grid.days[0]);
+            },
+            expected: true
+        },
+        {
+            name: 'Month grid rejects an invalid month',
+            func: () => {
+                try {
+                    DateConverter.monthGrid(2017, 14);
+                    return false;
+                } catch (error) {
+                    return error instanceof RangeError;
+                }
+            },
+            expected: true
+        }
+    ];
+    
+    for (const test of holidayTests) {
+        try {
+            const result = test.func();
+            const match = result === test.expected;
+            
+            console.log(`${match ? 'PASS' : 'FAIL'} ${test.name}`);
+            
+            if (match) passed++;
+            total++;
+        } catch (error) {
+            console.log(`FAIL ${test.name} - Error: ${error.message}`);
+            total++;
+        }
+    }
+    console.log();
+    
+    console.log('=== Async Batch Tests ===');
+    const asyncTests = [
+        {
+            name: 'convertBatchAsync matches gregorianToEthiopicBatch',
+            func: async () => {
+                const expected = DateConverter.gregorianToEthiopicBatch(years, months, days);
+                const out = await DateConverter.convertBatchAsync('gregorianToEthiopic', years, months, days);
+                return out.year.every((year, i) => year === expected.year[i] &&
+                    out.month[i] === expected.month[i] && out.day[i] === expected.day[i]);
+            },
+            expected: true
+        },
+        {
+            name: 'convertBatchAsync splits large inputs across threads',
+            func: async () => {
+                const jdn = new Int32Array(300000).map((_, i) => startJdn + i);
+                const out = await DateConverter.convertBatchAsync('jdnToEthiopic', jdn);
+                const back = await DateConverter.convertBatchAsync('ethiopicToJDN', out.year, out.month, out.day);
+                return back.every((value, i) => value === jdn[i]);
+            },
+            expected: true
+        },
+        {
+            name: 'convertBatchAsync survives inputs transferred in flight',
+            func: async () => {
+                const jdn = new Int32Array(300000).map((_, i) => startJdn + i);
+                const expected = DateConverter.jdnToEthiopicBatch(jdn);
+                const pending = DateConverter.convertBatchAsync('jdnToEthiopic', jdn);
+                const { port1 } = new MessageChannel();
+                port1.postMessage(jdn.buffer, [jdn.buffer]);
+                port1.close();
+                const out = await pending;
+                return jdn.length === 0 && out.year.every((year, i) => year === expected.year[i] &&
+                    out.month[i] === expected.month[i] && out.day[i] === expected.day[i]);
+            },
+            expected: true
+        },
+        {
+            name: 'convertBatchAsync rejects outputs transferred in flight',
+            func: async () => {
+                const jdn = new Int32Array(300000).map((_, i) => startJdn + i);
+                const out = new Int32Array(jdn.length);
+                const pending = DateConverter.convertBatchAsync('jdnToGregorian', jdn, new Int32Array(jdn.length), new Int32Array(jdn.length), out);
+                const { port1 } = new MessageChannel();
+                port1.postMessage(out.buffer, [out.buffer]);
+                port1.close();
+                try {
+                    await pending;
+                    return false;
+                } catch (error) {
+                    return error instanceof TypeError;
+                }
+            },
+            expected: true
+        },
+        {
+            name: 'convertBatchAsync rejects unknown conversions',
+            func: async () => {
+                try {
+                    await DateConverter.convertBatchAsync('julianToEthiopic', years, months, days);
+                    return false;
+                } catch (error) {
+                    return error instanceof TypeError;
+                }
+            },
+            expected: true
+        }
+    ];
+    
+    for (const test of asyncTests) {
+        try {
+            const result = await test.func();
+            const match = result === test.expected;
+            
+            console.log(`${match ? 'PASS' : 'FAIL'} ${test.name}`);
+            
+            if (match) passed++;
+            total++;
+        } catch (error) {
+            console.log(`FAIL ${test.name} - Error: ${error.message}`);
+            total++;
+        }
+    }
+    console.log();
+    
     console.log(`\n=== Results ===`);
     console.log(`Passed: ${passed}/${total} tests`);
     console.log(`Success Rate: ${((passed / total) * 100).toFixed(1)}%`);
@@ -0,0 +1,61 @@
+"""
+Import-time benchmark for the ethiopian_date_converter package.
+
+Each scenario runs in a fresh interpreter, so nothing is cached between runs.
+The time of `python -c pass` is measured the same way and subtracted, leaving
+the cost attributable to the package:
+
+    python benchmarks/bench_import.py [--runs N] [--json]
+
+Scenarios:
+    import        import ethiopian_date_converter
+    first_call    the import plus one gregorian_to_ethiopic call (loads the C core)
+    date_classes  the import plus one EthiopicDate (loads datetime and the classes)
+"""
+
+import argparse
+import json
+import os
+import statistics
+import subprocess
+import sys
+import time
+
+PACKAGE_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SCENARIOS = {
+    "baseline": "pass",
+    "import": "import ethiopian_date_converter",
+    "first_call": "import ethiopian_date_converter as e; e.gregorian_to_ethiopic(2024, 9, 11)",
+    "date_classes": "import ethiopian_date_converter as e; e.EthiopicDate(2017, 1, 1)",
+}
+
+def time_interpreter(code: str, runs: int) -> float:
+    """Median wall time in milliseconds of `python -c code` over runs fresh interpreters."""
+    env = dict(os.environ, PYTHONPATH=PACKAGE_DIR + os.pathsep + os.environ.get("PYTHONPATH", ""))
+    samples = []
+    for _ in range(runs):
+        start = time.perf_counter()
+        subprocess.run([sys.executable, "-c", code], check=True, env=env)
+        samples.append((time.perf_counter() - start) * 1000)
+    return statistics.median(samples)
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--runs", type=int, default=20, help="interpreters per scenario (default 20)")
+    parser.add_argument("--json", action="store_true", help="print results as JSON")
+    args = parser.parse_args()
+    
+    medians = {name: time_interpreter(code, args.runs) for name, code in SCENARIOS.items()}
+    results = {name: medians[name] - medians["baseline"] for name in SCENARIOS if name != "baseline"}
+    
+    if args.json:
+        print(json.dumps({"baseline_ms": medians["baseline"], "package_ms": results}, indent=2))
+        return
+    print(f"{'scenario':<14}{'ms over python -c pass':>24}")
+    for name, ms in results.items():
+        print(f"{name:<14}{ms:>24.2f}")
+    print(f"(interpreter startup: {medians['baseline']:.2f} ms, median of {args.runs} runs)")
+
+if __name__ == "__main__":
+    main()
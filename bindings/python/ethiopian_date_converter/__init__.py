@@ -4,40 +4,124 @@ Ethiopian Date Converter for Python
 High-performance Ethiopian calendar date conversion with native C implementation.
 """
 
-from .converter import (
-    ethiopic_to_gregorian,
-    gregorian_to_ethiopic,
-    is_valid_ethiopic_date,
-    is_valid_gregorian_date,
-    is_gregorian_leap,
-    ethiopic_to_jdn,
-    gregorian_to_jdn,
-    jdn_to_ethiopic,
-    jdn_to_gregorian,
-    get_day_of_week,
-)
+import importlib
+TYPE_CHECKING = False  # typing.TYPE_CHECKING without importing typing
 
-from .date_classes import (
-    EthiopicDate,
-    GregorianDate,
-)
+# Public names and the submodule that defines each. Submodules are imported on
+# first attribute access (PEP 562), so `import ethiopian_date_converter` loads
+# neither the C core nor datetime until something is actually used.
+_SUBMODULE_EXPORTS = {
+    "converter": (
+        "ethiopic_to_gregorian",
+        "gregorian_to_ethiopic",
+        "is_valid_ethiopic_date",
+        "is_valid_gregorian_date",
+        "is_gregorian_leap",
+        "ethiopic_to_jdn",
+        "gregorian_to_jdn",
+        "jdn_to_ethiopic",
+        "jdn_to_gregorian",
+        "get_day_of_week",
+        "business_days_between",
+        "is_ethiopic_holiday",
+        "ethiopic_holiday_name",
+        "next_ethiopic_holiday",
+        "next_ethiopic_holiday_after",
+        "ethiopic_holidays_in_range",
+        "ethiopic_easter",
+        "load_islamic_holidays",
+        "month_grid",
+        "cached_month_grid",
+        "gregorian_to_ethiopic_batch",
+        "ethiopic_to_gregorian_batch",
+        "gregorian_to_jdn_batch",
+        "ethiopic_to_jdn_batch",
+        "jdn_to_gregorian_batch",
+        "jdn_to_ethiopic_batch",
+    ),
+    "date_classes": (
+        "EthiopicDate",
+        "GregorianDate",
+    ),
+    "constants": (
+        "ETHIOPIC_MONTHS",
+        "GREGORIAN_MONTHS",
+        "WEEKDAYS",
+        "JD_EPOCH_OFFSET_AMETE_ALEM",
+        "JD_EPOCH_OFFSET_AMETE_MIHRET",
+        "JD_EPOCH_OFFSET_GREGORIAN",
+    ),
+    "utils": (
+        "get_current_ethiopic_date",
+        "get_current_gregorian_date",
+        "generate_calendar",
+        "get_business_days",
+        "get_holidays",
+    ),
+}
 
-from .constants import (
-    ETHIOPIC_MONTHS,
-    GREGORIAN_MONTHS,
-    WEEKDAYS,
-    JD_EPOCH_OFFSET_AMETE_ALEM,
-    JD_EPOCH_OFFSET_AMETE_MIHRET,
-    JD_EPOCH_OFFSET_GREGORIAN,
-)
+_EXPORT_MODULES = {
+    name: module for module, names in _SUBMODULE_EXPORTS.items() for name in names
+}
 
-from .utils import (
-    get_current_ethiopic_date,
-    get_current_gregorian_date,
-    generate_calendar,
-    get_business_days,
-    get_holidays,
-)
+if TYPE_CHECKING:
+    from .converter import (
+        ethiopic_to_gregorian,
+        gregorian_to_ethiopic,
+        is_valid_ethiopic_date,
+        is_valid_gregorian_date,
+        is_gregorian_leap,
+        ethiopic_to_jdn,
+        gregorian_to_jdn,
+        jdn_to_ethiopic,
+        jdn_to_gregorian,
+        get_day_of_week,
+        business_days_between,
+        is_ethiopic_holiday,
+        ethiopic_holiday_name,
+        next_ethiopic_holiday,
+        next_ethiopic_holiday_after,
+        ethiopic_holidays_in_range,
+        ethiopic_easter,
+        load_islamic_holidays,
+        month_grid,
+        cached_month_grid,
+        gregorian_to_ethiopic_batch,
+        ethiopic_to_gregorian_batch,
+        gregorian_to_jdn_batch,
+        ethiopic_to_jdn_batch,
+        jdn_to_gregorian_batch,
+        jdn_to_ethiopic_batch,
+    )
+    from .date_classes import EthiopicDate, GregorianDate
+    from .constants import (
+        ETHIOPIC_MONTHS,
+        GREGORIAN_MONTHS,
+        WEEKDAYS,
+        JD_EPOCH_OFFSET_AMETE_ALEM,
+        JD_EPOCH_OFFSET_AMETE_MIHRET,
+        JD_EPOCH_OFFSET_GREGORIAN,
+    )
+    from .utils import (
+        get_current_ethiopic_date,
+        get_current_gregorian_date,
+        generate_calendar,
+        get_business_days,
+        get_holidays,
+    )
+
+def __getattr__(name):
+    module_name = _EXPORT_MODULES.get(name)
+    if module_name is None:
+        raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+    module = importlib.import_module("." + module_name, __name__)
+    value = getattr(module, name)
+    # Cache on the package so later lookups skip __getattr__
+    globals()[name] = value
+    return value
+
+def __dir__():
+    return sorted(set(globals()) | set(_EXPORT_MODULES))
 
 __version__ = "1.0.0"
 __author__ = "Abiy"
@@ -57,6 +141,28 @@ __all__ = [
     "jdn_to_ethiopic",
     "jdn_to_gregorian",
     "get_day_of_week",
+    "business_days_between",
+    
+    # Holiday functions
+    "is_ethiopic_holiday",
+    "ethiopic_holiday_name",
+    "next_ethiopic_holiday",
+    "next_ethiopic_holiday_after",
+    "ethiopic_holidays_in_range",
+    "ethiopic_easter",
+    "load_islamic_holidays",
+    
+    # Month grids
+    "month_grid",
+    "cached_month_grid",
+    
+    # Batch conversion functions
+    "gregorian_to_ethiopic_batch",
+    "ethiopic_to_gregorian_batch",
+    "gregorian_to_jdn_batch",
+    "ethiopic_to_jdn_batch",
+    "jdn_to_gregorian_batch",
+    "jdn_to_ethiopic_batch",
     
     # Date classes
     "EthiopicDate",
@@ -0,0 +1,244 @@
+"""
+ctypes access to the C core, used when the _native extension is unavailable.
+
+Kept out of converter.py so that the native path never imports ctypes.
+"""
+
+import ctypes
+import os
+import platform
+from ctypes import c_int8, c_int32, c_int64, c_uint8, c_bool, c_char_p, c_size_t, c_void_p, POINTER, Structure
+
+class DateStruct(Structure):
+    """C date_t structure."""
+    _fields_ = [
+        ("year", c_int32),
+        ("month", c_int32),
+        ("day", c_int32),
+    ]
+
+class DatedHolidayStruct(Structure):
+    """C ethiopic_dated_holiday_t structure."""
+    _fields_ = [
+        ("jdn", c_int64),
+        ("id", c_int32),
+    ]
+
+class MonthGridStruct(Structure):
+    """C ethiopic_month_grid_t structure (ETHIOPIC_GRID_WEEKS = 6)."""
+    _fields_ = [
+        ("days_in_month", c_int32),
+        ("first_weekday", c_int32),
+        ("weeks", c_int32),
+        ("jdn", (c_int64 * 7) * 6),
+        ("day", (c_uint8 * 7) * 6),
+        ("holiday", (c_int8 * 7) * 6),
+    ]
+
+# Capsule names are not copied, so the bytes object must outlive every capsule
+_HOLIDAY_LOOKUP_NAME = b"ethiopian_date_converter.holiday_lookup"
+
+class EthiopicCalendarLib:
+    """Wrapper for the native Ethiopian calendar C library."""
+    
+    def __init__(self):
+        self._lib = None
+        self._holiday_lookup = None
+        self._load_library()
+        self._setup_functions()
+    
+    def holiday_lookup_capsule(self):
+        """
+        Capsule of this library's is_ethiopic_holiday, for the NumPy ufuncs.
+        
+        Like the one of the _native extension, it points to a variable holding
+        the function pointer; the variable lives as long as this object.
+        """
+        if self._holiday_lookup is None:
+            self._holiday_lookup = ctypes.cast(self._lib.is_ethiopic_holiday, c_void_p)
+        capsule_new = ctypes.pythonapi.PyCapsule_New
+        capsule_new.argtypes = [c_void_p, c_char_p, c_void_p]
+        capsule_new.restype = ctypes.py_object
+        return capsule_new(ctypes.addressof(self._holiday_lookup), _HOLIDAY_LOOKUP_NAME, None)
+    
+    def _load_library(self):
+        """Load the compiled C library."""
+        # Try to find the compiled library
+        system = platform.system().lower()
+        if system == "windows":
+            lib_name = "ethiopic_calendar.dll"
+        elif system == "darwin":
+            lib_name = "libethiopic_calendar.dylib"
+        else:
+            lib_name = "libethiopic_calendar.so"
+        
+        # Installed packages carry the library built by setup.py
+        lib_path = os.path.join(os.path.dirname(__file__), "core", lib_name)
+        
+        if not os.path.exists(lib_path):
+            # Source checkouts compile it once into the user cache, never into the package
+            core_dir = self._find_core_dir()
+            lib_dir = self._cache_dir(core_dir)
+            lib_path = os.path.join(lib_dir, lib_name)
+            if not os.path.exists(lib_path):
+                self._compile_library(core_dir, lib_dir, lib_name)
+        
+        try:
+            self._lib = ctypes.CDLL(lib_path)
+        except OSError as e:
+            raise ImportError(f"Could not load Ethiopian calendar library: {e}")
+    
+    def _find_core_dir(self) -> str:
+        """Locate the C core: the copy shipped in the package, or core/ of a source checkout."""
+        package_dir = os.path.dirname(os.path.abspath(__file__))
+        candidates = [
+            os.path.join(package_dir, "core"),
+            os.path.join(package_dir, "..", "..", "..", "core"),
+        ]
+        for candidate in candidates:
+            if os.path.exists(os.path.join(candidate, "build-flags.json")):
+                return os.path.normpath(candidate)
+        raise FileNotFoundError("C core not found; expected core/build-flags.json")
+    
+    def _cache_dir(self, core_dir: str) -> str:
+        """
+        Per-user directory for a library compiled at runtime from core_dir.
+        
+        It is keyed by a hash of the build flags, sources and headers, so a
+        changed core gets a fresh build instead of loading a stale one.
+        """
+        import hashlib
+        import json
+        
+        if platform.system().lower() == "windows":
+            base = os.environ.get("LOCALAPPDATA") or os.path.expanduser(os.path.join("~", "AppData", "Local"))
+        else:
+            base = os.environ.get("XDG_CACHE_HOME") or os.path.expanduser(os.path.join("~", ".cache"))
+        
+        flags_path = os.path.join(core_dir, "build-flags.json")
+        with open(flags_path, "r") as f:
+            flags = json.load(f)
+        files = [flags_path] + [os.path.join(core_dir, source) for source in flags["sources"]]
+        for include_dir in flags["include_dirs"]:
+            include_dir = os.path.join(core_dir, include_dir)
+            files += [os.path.join(include_dir, name) for name in sorted(os.listdir(include_dir))
+                      if name.endswith(".h")]
+        digest = hashlib.sha256()
+        for path in files:
+            with open(path, "rb") as f:
+                digest.update(f.read())
+        
+        key = "%s-%s" % (platform.machine() or "unknown", digest.hexdigest()[:16])
+        return os.path.join(base, "ethiopian-date-converter", key)
+    
+    def _compile_library(self, core_dir: str, lib_dir: str, lib_name: str):
+        """
+        Compile the C library on the fly.
+        
+        The compiler writes a temporary file that is then renamed into place, so
+        processes compiling at the same time never load a partly written library.
+        """
+        import json
+        import subprocess
+        import tempfile
+        
+        with open(os.path.join(core_dir, "build-flags.json"), "r") as f:
+            flags = json.load(f)
+        
+        sources = [os.path.join(core_dir, source) for source in flags["sources"]]
+        include_dirs = [os.path.join(core_dir, d) for d in flags["include_dirs"]]
+        os.makedirs(lib_dir, exist_ok=True)
+        fd, lib_path = tempfile.mkstemp(prefix="build-", suffix="-" + lib_name, dir=lib_dir)
+        os.close(fd)
+        
+        gcc_cmd = (["gcc", "-shared"] + flags["cflags"] + flags["optimize_cflags"] +
+                   ["-I" + d for d in include_dirs] + ["-o", lib_path] + sources)
+        
+        try:
+            system = platform.system().lower()
+            if system == "windows":
+                # Try to compile with gcc (MinGW) or cl (MSVC)
+                try:
+                    subprocess.run(gcc_cmd, check=True, capture_output=True)
+                except (subprocess.CalledProcessError, FileNotFoundError):
+                    subprocess.run(
+                        ["cl", "/LD"] + flags["msvc_cflags"] +
+                        ["/I" + d for d in include_dirs] + [f"/Fe:{lib_path}"] + sources,
+                        check=True, capture_output=True)
+            else:
+                # Unix-like systems
+                subprocess.run(gcc_cmd, check=True, capture_output=True)
+            os.replace(lib_path, os.path.join(lib_dir, lib_name))
+        except subprocess.CalledProcessError as e:
+            raise RuntimeError(f"Failed to compile C library: {e}")
+        finally:
+            if os.path.exists(lib_path):
+                os.remove(lib_path)
+    
+    def _setup_functions(self):
+        """Setup function signatures for the C library."""
+        # is_gregorian_leap
+        self._lib.is_gregorian_leap.argtypes = [c_int32]
+        self._lib.is_gregorian_leap.restype = c_bool
+        
+        # is_valid_gregorian_date
+        self._lib.is_valid_gregorian_date.argtypes = [c_int32, c_int32, c_int32]
+        self._lib.is_valid_gregorian_date.restype = c_bool
+        
+        # is_valid_ethiopic_date
+        self._lib.is_valid_ethiopic_date.argtypes = [c_int32, c_int32, c_int32]
+        self._lib.is_valid_ethiopic_date.restype = c_bool
+        
+        # gregorian_to_jdn
+        self._lib.gregorian_to_jdn.argtypes = [c_int32, c_int32, c_int32]
+        self._lib.gregorian_to_jdn.restype = c_int64
+        
+        # ethiopic_to_jdn
+        self._lib.ethiopic_to_jdn.argtypes = [c_int32, c_int32, c_int32, c_int64]
+        self._lib.ethiopic_to_jdn.restype = c_int64
+        
+        # jdn_to_gregorian
+        self._lib.jdn_to_gregorian.argtypes = [c_int64]
+        self._lib.jdn_to_gregorian.restype = DateStruct
+        
+        # jdn_to_ethiopic
+        self._lib.jdn_to_ethiopic.argtypes = [c_int64, c_int64]
+        self._lib.jdn_to_ethiopic.restype = DateStruct
+        
+        # ethiopic_to_gregorian
+        self._lib.ethiopic_to_gregorian.argtypes = [c_int32, c_int32, c_int32, c_int64]
+        self._lib.ethiopic_to_gregorian.restype = DateStruct
+        
+        # gregorian_to_ethiopic
+        self._lib.gregorian_to_ethiopic.argtypes = [c_int32, c_int32, c_int32]
+        self._lib.gregorian_to_ethiopic.restype = DateStruct
+        
+        # guess_era
+        self._lib.guess_era.argtypes = [c_int64]
+        self._lib.guess_era.restype = c_int64
+        
+        # business_days_between
+        self._lib.business_days_between.argtypes = [c_int64, c_int64, c_bool]
+        self._lib.business_days_between.restype = c_int64
+        
+        # Holidays
+        self._lib.is_ethiopic_holiday.argtypes = [c_int64]
+        self._lib.is_ethiopic_holiday.restype = c_bool
+        self._lib.ethiopic_holiday_id.argtypes = [c_int64]
+        self._lib.ethiopic_holiday_id.restype = c_int32
+        self._lib.ethiopic_holiday_name.argtypes = [c_int32]
+        self._lib.ethiopic_holiday_name.restype = c_char_p
+        self._lib.ethiopic_next_holiday.argtypes = [c_int64, POINTER(c_int32)]
+        self._lib.ethiopic_next_holiday.restype = c_int64
+        self._lib.ethiopic_next_holiday_after.argtypes = [c_int64, POINTER(c_int32)]
+        self._lib.ethiopic_next_holiday_after.restype = c_int64
+        self._lib.ethiopic_holidays_in_range.argtypes = [c_int64, c_int64, POINTER(DatedHolidayStruct), c_size_t]
+        self._lib.ethiopic_holidays_in_range.restype = c_size_t
+        self._lib.ethiopic_easter.argtypes = [c_int32]
+        self._lib.ethiopic_easter.restype = c_int64
+        self._lib.ethiopic_load_islamic_holidays.argtypes = [c_char_p]
+        self._lib.ethiopic_load_islamic_holidays.restype = c_int32
+        
+        # Month grids; the calendar is ETHIOPIC_GRID_ETHIOPIC (0) or ETHIOPIC_GRID_GREGORIAN (1)
+        self._lib.ethiopic_month_grid.argtypes = [c_int32, c_int32, c_int32, POINTER(MonthGridStruct)]
+        self._lib.ethiopic_month_grid.restype = c_bool
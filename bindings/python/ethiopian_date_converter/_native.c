@@ -0,0 +1,859 @@
+/*
+ * CPython extension exposing the C core to ethiopian_date_converter.converter.
+ *
+ * Every function takes its arguments through METH_FASTCALL, so a call costs one
+ * vector of object pointers instead of a tuple, and results are built directly
+ * from the core's date_t. Behaviour matches the ctypes functions in converter.py,
+ * which remain as the fallback when this module is not built.
+ *
+ * The _batch functions convert whole buffers (array.array, NumPy arrays or anything
+ * else exporting the buffer protocol) and release the GIL while converting, which
+ * is safe because the core keeps no unsynchronized state.
+ *
+ * setup.py builds this file twice on x86-64: as _native for any CPU, and as
+ * _native_x86_64_v3 (NATIVE_MODULE set, AVX2/BMI2/FMA enabled) which converter.py
+ * loads instead when supports_x86_64_v3() reports that the CPU can run it.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <string.h>
+#include "ethiopic_calendar.h"
+
+#ifndef NATIVE_MODULE
+#define NATIVE_MODULE _native
+#endif
+#define NATIVE_STRINGIFY(name) #name
+#define NATIVE_NAME(name) NATIVE_STRINGIFY(name)
+#define NATIVE_INIT_FUNC(name) NATIVE_INIT_FUNC_(name)
+#define NATIVE_INIT_FUNC_(name) PyInit_##name
+
+/* Interned dictionary keys for date results */
+static PyObject* key_year;
+static PyObject* key_month;
+static PyObject* key_day;
+
+/**
+ * Matches positional and keyword arguments against names[] and stores them in
+ * values[], leaving omitted optional arguments NULL. The first `required` names
+ * must be given. Returns 0 on success, -1 with TypeError set.
+ */
+static int parse_args(const char* func, const char* const* names, Py_ssize_t count,
+                      Py_ssize_t required, PyObject* const* args, Py_ssize_t nargs,
+                      PyObject* kwnames, PyObject** values) {
+    Py_ssize_t i, j;
+
+    if (nargs > count) {
+        PyErr_Format(PyExc_TypeError, "%s() takes at most %zd arguments (%zd given)",
+                     func, count, nargs);
+        return -1;
+    }
+    for (i = 0; i < count; i++) {
+        values[i] = (i < nargs) ? args[i] : NULL;
+    }
+
+    if (kwnames != NULL) {
+        for (j = 0; j < PyTuple_GET_SIZE(kwnames); j++) {
+            PyObject* name = PyTuple_GET_ITEM(kwnames, j);
+            for (i = 0; i < count; i++) {
+                if (PyUnicode_CompareWithASCIIString(name, names[i]) == 0) {
+                    break;
+                }
+            }
+            if (i == count) {
+                PyErr_Format(PyExc_TypeError, "%s() got an unexpected keyword argument '%U'",
+                             func, name);
+                return -1;
+            }
+            if (values[i] != NULL) {
+                PyErr_Format(PyExc_TypeError, "%s() got multiple values for argument '%s'",
+                             func, names[i]);
+                return -1;
+            }
+            values[i] = args[nargs + j];
+        }
+    }
+
+    for (i = 0; i < required; i++) {
+        if (values[i] == NULL) {
+            PyErr_Format(PyExc_TypeError, "%s() missing required argument '%s'", func, names[i]);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int as_int64(PyObject* value, int64_t* out) {
+    long long result = PyLong_AsLongLong(value);
+    if (result == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    *out = (int64_t)result;
+    return 0;
+}
+
+static int as_int32(PyObject* value, const char* name, int32_t* out) {
+    int64_t result;
+    if (as_int64(value, &result) < 0) {
+        return -1;
+    }
+    if (result < INT32_MIN || result > INT32_MAX) {
+        PyErr_Format(PyExc_OverflowError, "%s out of range", name);
+        return -1;
+    }
+    *out = (int32_t)result;
+    return 0;
+}
+
+/** Reads year, month, day from values[0..2] */
+static int as_date(PyObject* const* values, int32_t* year, int32_t* month, int32_t* day) {
+    return (as_int32(values[0], "year", year) < 0 ||
+            as_int32(values[1], "month", month) < 0 ||
+            as_int32(values[2], "day", day) < 0) ? -1 : 0;
+}
+
+/** Reads an optional era, defaulting to Amete Mihret when omitted or None */
+static int as_era(PyObject* value, int64_t* era) {
+    if (value == NULL || value == Py_None) {
+        *era = JD_EPOCH_OFFSET_AMETE_MIHRET;
+        return 0;
+    }
+    return as_int64(value, era);
+}
+
+static PyObject* date_to_dict(date_t date) {
+    PyObject* dict = PyDict_New();
+    PyObject* year = PyLong_FromLong(date.year);
+    PyObject* month = PyLong_FromLong(date.month);
+    PyObject* day = PyLong_FromLong(date.day);
+
+    if (dict == NULL || year == NULL || month == NULL || day == NULL ||
+        PyDict_SetItem(dict, key_year, year) < 0 ||
+        PyDict_SetItem(dict, key_month, month) < 0 ||
+        PyDict_SetItem(dict, key_day, day) < 0) {
+        Py_CLEAR(dict);
+    }
+    Py_XDECREF(year);
+    Py_XDECREF(month);
+    Py_XDECREF(day);
+    return dict;
+}
+
+static const char* const date_names[] = {"year", "month", "day", "era"};
+static const char* const jdn_names[] = {"jdn", "era"};
+
+static PyObject* native_ethiopic_to_gregorian(PyObject* self, PyObject* const* args,
+                                              Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[4];
+    int32_t year, month, day;
+    int64_t era;
+    (void)self;
+
+    if (parse_args("ethiopic_to_gregorian", date_names, 4, 3, args, nargs, kwnames, values) < 0 ||
+        as_date(values, &year, &month, &day) < 0) {
+        return NULL;
+    }
+    if (!is_valid_ethiopic_date(year, month, day)) {
+        return PyErr_Format(PyExc_ValueError, "Invalid Ethiopian date: %d-%d-%d", year, month, day);
+    }
+
+    if (values[3] == NULL || values[3] == Py_None) {
+        era = guess_era(ethiopic_to_jdn(year, month, day, JD_EPOCH_OFFSET_AMETE_MIHRET));
+    } else if (as_int64(values[3], &era) < 0) {
+        return NULL;
+    }
+    return date_to_dict(ethiopic_to_gregorian(year, month, day, era));
+}
+
+static PyObject* native_gregorian_to_ethiopic(PyObject* self, PyObject* const* args,
+                                              Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[3];
+    int32_t year, month, day;
+    (void)self;
+
+    if (parse_args("gregorian_to_ethiopic", date_names, 3, 3, args, nargs, kwnames, values) < 0 ||
+        as_date(values, &year, &month, &day) < 0) {
+        return NULL;
+    }
+    if (!is_valid_gregorian_date(year, month, day)) {
+        return PyErr_Format(PyExc_ValueError, "Invalid Gregorian date: %d-%d-%d", year, month, day);
+    }
+    return date_to_dict(gregorian_to_ethiopic(year, month, day));
+}
+
+static PyObject* native_is_valid_ethiopic_date(PyObject* self, PyObject* const* args,
+                                               Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[3];
+    int32_t year, month, day;
+    (void)self;
+
+    if (parse_args("is_valid_ethiopic_date", date_names, 3, 3, args, nargs, kwnames, values) < 0 ||
+        as_date(values, &year, &month, &day) < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(is_valid_ethiopic_date(year, month, day));
+}
+
+static PyObject* native_is_valid_gregorian_date(PyObject* self, PyObject* const* args,
+                                                Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[3];
+    int32_t year, month, day;
+    (void)self;
+
+    if (parse_args("is_valid_gregorian_date", date_names, 3, 3, args, nargs, kwnames, values) < 0 ||
+        as_date(values, &year, &month, &day) < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(is_valid_gregorian_date(year, month, day));
+}
+
+static PyObject* native_is_gregorian_leap(PyObject* self, PyObject* const* args,
+                                          Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[1];
+    int32_t year;
+    (void)self;
+
+    if (parse_args("is_gregorian_leap", date_names, 1, 1, args, nargs, kwnames, values) < 0 ||
+        as_int32(values[0], "year", &year) < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(is_gregorian_leap(year));
+}
+
+static PyObject* native_ethiopic_to_jdn(PyObject* self, PyObject* const* args,
+                                        Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[4];
+    int32_t year, month, day;
+    int64_t era;
+    (void)self;
+
+    if (parse_args("ethiopic_to_jdn", date_names, 4, 3, args, nargs, kwnames, values) < 0 ||
+        as_date(values, &year, &month, &day) < 0 || as_era(values[3], &era) < 0) {
+        return NULL;
+    }
+    return PyLong_FromLongLong(ethiopic_to_jdn(year, month, day, era));
+}
+
+static PyObject* native_gregorian_to_jdn(PyObject* self, PyObject* const* args,
+                                         Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[3];
+    int32_t year, month, day;
+    (void)self;
+
+    if (parse_args("gregorian_to_jdn", date_names, 3, 3, args, nargs, kwnames, values) < 0 ||
+        as_date(values, &year, &month, &day) < 0) {
+        return NULL;
+    }
+    return PyLong_FromLongLong(gregorian_to_jdn(year, month, day));
+}
+
+static PyObject* native_jdn_to_ethiopic(PyObject* self, PyObject* const* args,
+                                        Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[2];
+    int64_t jdn, era;
+    (void)self;
+
+    if (parse_args("jdn_to_ethiopic", jdn_names, 2, 1, args, nargs, kwnames, values) < 0 ||
+        as_int64(values[0], &jdn) < 0 || as_era(values[1], &era) < 0) {
+        return NULL;
+    }
+    return date_to_dict(jdn_to_ethiopic(jdn, era));
+}
+
+static PyObject* native_jdn_to_gregorian(PyObject* self, PyObject* const* args,
+                                         Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[1];
+    int64_t jdn;
+    (void)self;
+
+    if (parse_args("jdn_to_gregorian", jdn_names, 1, 1, args, nargs, kwnames, values) < 0 ||
+        as_int64(values[0], &jdn) < 0) {
+        return NULL;
+    }
+    return date_to_dict(jdn_to_gregorian(jdn));
+}
+
+static const char* const range_names[] = {"start_jdn", "end_jdn", "exclude_holidays"};
+
+static PyObject* native_business_days_between(PyObject* self, PyObject* const* args,
+                                              Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[3];
+    int64_t start_jdn, end_jdn;
+    int exclude_holidays = 1;
+    (void)self;
+
+    if (parse_args("business_days_between", range_names, 3, 2, args, nargs, kwnames, values) < 0 ||
+        as_int64(values[0], &start_jdn) < 0 || as_int64(values[1], &end_jdn) < 0) {
+        return NULL;
+    }
+    if (values[2] != NULL && (exclude_holidays = PyObject_IsTrue(values[2])) < 0) {
+        return NULL;
+    }
+    return PyLong_FromLongLong(business_days_between(start_jdn, end_jdn, exclude_holidays));
+}
+
+/* Holidays */
+
+static PyObject* holiday_name_or_none(int32_t id) {
+    if (id == ETHIOPIC_HOLIDAY_NONE) {
+        Py_RETURN_NONE;
+    }
+    return PyUnicode_FromString(ethiopic_holiday_name(id));
+}
+
+static PyObject* native_is_ethiopic_holiday(PyObject* self, PyObject* const* args,
+                                            Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[1];
+    int64_t jdn;
+    (void)self;
+
+    if (parse_args("is_ethiopic_holiday", jdn_names, 1, 1, args, nargs, kwnames, values) < 0 ||
+        as_int64(values[0], &jdn) < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(is_ethiopic_holiday(jdn));
+}
+
+static PyObject* native_ethiopic_holiday_name(PyObject* self, PyObject* const* args,
+                                              Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[1];
+    int64_t jdn;
+    (void)self;
+
+    if (parse_args("ethiopic_holiday_name", jdn_names, 1, 1, args, nargs, kwnames, values) < 0 ||
+        as_int64(values[0], &jdn) < 0) {
+        return NULL;
+    }
+    return holiday_name_or_none(ethiopic_holiday_id(jdn));
+}
+
+static PyObject* native_next_ethiopic_holiday(PyObject* self, PyObject* const* args,
+                                              Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[1];
+    int64_t jdn;
+    int32_t id;
+    (void)self;
+
+    if (parse_args("next_ethiopic_holiday", jdn_names, 1, 1, args, nargs, kwnames, values) < 0 ||
+        as_int64(values[0], &jdn) < 0) {
+        return NULL;
+    }
+    jdn = ethiopic_next_holiday(jdn, &id);
+    return Py_BuildValue("(LN)", (long long)jdn, holiday_name_or_none(id));
+}
+
+static PyObject* native_next_ethiopic_holiday_after(PyObject* self, PyObject* const* args,
+                                                    Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[1];
+    int64_t jdn;
+    int32_t id;
+    (void)self;
+
+    if (parse_args("next_ethiopic_holiday_after", jdn_names, 1, 1, args, nargs, kwnames, values) < 0 ||
+        as_int64(values[0], &jdn) < 0) {
+        return NULL;
+    }
+    jdn = ethiopic_next_holiday_after(jdn, &id);
+    return Py_BuildValue("(LN)", (long long)jdn, holiday_name_or_none(id));
+}
+
+static PyObject* native_ethiopic_holidays_in_range(PyObject* self, PyObject* const* args,
+                                                   Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[2];
+    int64_t start_jdn, end_jdn;
+    ethiopic_dated_holiday_t chunk[64];
+    size_t written;
+    PyObject* result;
+    (void)self;
+
+    if (parse_args("ethiopic_holidays_in_range", range_names, 2, 2, args, nargs, kwnames, values) < 0 ||
+        as_int64(values[0], &start_jdn) < 0 || as_int64(values[1], &end_jdn) < 0) {
+        return NULL;
+    }
+    if ((result = PyList_New(0)) == NULL) {
+        return NULL;
+    }
+    // A full chunk may be followed by more holidays, from the day after its last one
+    do {
+        written = ethiopic_holidays_in_range(start_jdn, end_jdn, chunk, 64);
+        for (size_t i = 0; i < written; i++) {
+            PyObject* item = Py_BuildValue("(LN)", (long long)chunk[i].jdn, holiday_name_or_none(chunk[i].id));
+            if (item == NULL || PyList_Append(result, item) < 0) {
+                Py_XDECREF(item);
+                Py_DECREF(result);
+                return NULL;
+            }
+            Py_DECREF(item);
+        }
+        if (written > 0) {
+            start_jdn = chunk[written - 1].jdn + 1;
+        }
+    } while (written == 64);
+    return result;
+}
+
+static PyObject* native_ethiopic_easter(PyObject* self, PyObject* const* args,
+                                        Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[1];
+    int32_t year;
+    (void)self;
+
+    if (parse_args("ethiopic_easter", date_names, 1, 1, args, nargs, kwnames, values) < 0 ||
+        as_int32(values[0], "year", &year) < 0) {
+        return NULL;
+    }
+    return PyLong_FromLongLong(ethiopic_easter(year));
+}
+
+static const char* const path_names[] = {"path"};
+
+static PyObject* native_load_islamic_holidays(PyObject* self, PyObject* const* args,
+                                              Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[1];
+    PyObject* path;
+    int32_t result;
+    (void)self;
+
+    if (parse_args("load_islamic_holidays", path_names, 1, 1, args, nargs, kwnames, values) < 0 ||
+        !PyUnicode_FSConverter(values[0], &path)) {
+        return NULL;
+    }
+    result = ethiopic_load_islamic_holidays(PyBytes_AS_STRING(path));
+    Py_DECREF(path);
+
+    switch (result) {
+    case ETHIOPIC_HOLIDAY_ERROR_IO:
+        return PyErr_Format(PyExc_OSError, "cannot read Islamic holiday file %R", values[0]);
+    case ETHIOPIC_HOLIDAY_ERROR_FORMAT:
+        return PyErr_Format(PyExc_ValueError, "invalid Islamic holiday file %R", values[0]);
+    case ETHIOPIC_HOLIDAY_ERROR_MEMORY:
+        return PyErr_NoMemory();
+    default:
+        return PyLong_FromLong(result);
+    }
+}
+
+/* Month grids */
+
+static const char* const grid_names[] = {"year", "month", "calendar"};
+
+/* One 6x7 field of a month grid as a tuple of row tuples */
+static PyObject* grid_rows(const ethiopic_month_grid_t* grid, char field) {
+    PyObject* rows = PyTuple_New(ETHIOPIC_GRID_WEEKS);
+    if (rows == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t week = 0; week < ETHIOPIC_GRID_WEEKS; week++) {
+        PyObject* row = PyTuple_New(7);
+        if (row == NULL) {
+            Py_DECREF(rows);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(rows, week, row);
+        for (Py_ssize_t weekday = 0; weekday < 7; weekday++) {
+            PyObject* cell = field == 'j' ? PyLong_FromLongLong(grid->jdn[week][weekday])
+                           : field == 'd' ? PyLong_FromLong(grid->day[week][weekday])
+                           : holiday_name_or_none(grid->holiday[week][weekday]);
+            if (cell == NULL) {
+                Py_DECREF(rows);
+                return NULL;
+            }
+            PyTuple_SET_ITEM(row, weekday, cell);
+        }
+    }
+    return rows;
+}
+
+static PyObject* native_month_grid(PyObject* self, PyObject* const* args,
+                                   Py_ssize_t nargs, PyObject* kwnames) {
+    PyObject* values[3];
+    int32_t year, month;
+    const char* calendar = "ethiopic";
+    ethiopic_month_grid_t grid;
+    (void)self;
+
+    if (parse_args("month_grid", grid_names, 3, 2, args, nargs, kwnames, values) < 0 ||
+        as_int32(values[0], "year", &year) < 0 || as_int32(values[1], "month", &month) < 0) {
+        return NULL;
+    }
+    if (values[2] != NULL && (calendar = PyUnicode_AsUTF8(values[2])) == NULL) {
+        return NULL;
+    }
+    if (strcmp(calendar, "ethiopic") != 0 && strcmp(calendar, "gregorian") != 0) {
+        return PyErr_Format(PyExc_ValueError, "calendar must be 'ethiopic' or 'gregorian'");
+    }
+    if (!ethiopic_month_grid(calendar[0] == 'g' ? ETHIOPIC_GRID_GREGORIAN : ETHIOPIC_GRID_ETHIOPIC,
+                             year, month, &grid)) {
+        return PyErr_Format(PyExc_ValueError, "Invalid %s month: %d-%d", calendar, (int)year, (int)month);
+    }
+    return Py_BuildValue("{s:i,s:i,s:s,s:i,s:i,s:i,s:N,s:N,s:N}",
+                         "year", (int)year, "month", (int)month, "calendar", calendar,
+                         "days_in_month", (int)grid.days_in_month, "first_weekday", (int)grid.first_weekday,
+                         "weeks", (int)grid.weeks, "days", grid_rows(&grid, 'd'),
+                         "jdns", grid_rows(&grid, 'j'), "holidays", grid_rows(&grid, 'h'));
+}
+
+/* Batch conversions */
+
+#define BATCH_CHUNK 256
+
+typedef enum {
+    BATCH_GREGORIAN_TO_ETHIOPIC,
+    BATCH_ETHIOPIC_TO_GREGORIAN,
+    BATCH_GREGORIAN_TO_JDN,
+    BATCH_ETHIOPIC_TO_JDN,
+    BATCH_JDN_TO_GREGORIAN,
+    BATCH_JDN_TO_ETHIOPIC
+} batch_kind_t;
+
+/* One conversion over int32 year/month/day columns and int64 JDN columns */
+typedef struct {
+    batch_kind_t kind;
+    const int32_t* in[3];
+    const int64_t* in_jdn;
+    int32_t* out[3];
+    int64_t* out_jdn;
+    size_t n;
+    int64_t era;
+    int detect_era;
+} batch_job_t;
+
+/* Prototypes repeated to allocate output arrays: array('i', [0]) and array('q', [0]) */
+static PyObject* int32_prototype;
+static PyObject* int64_prototype;
+
+/**
+ * Borrowed prototype for the item size. Created on first use rather than at
+ * module init, so importing the package does not import the array module.
+ */
+static PyObject* get_prototype(Py_ssize_t itemsize) {
+    PyObject** prototype = itemsize == 4 ? &int32_prototype : &int64_prototype;
+
+    if (*prototype == NULL) {
+        PyObject* array_module = PyImport_ImportModule("array");
+        PyObject* created;
+        if (array_module == NULL) {
+            return NULL;
+        }
+        created = PyObject_CallMethod(array_module, "array", "s[i]", itemsize == 4 ? "i" : "q", 0);
+        Py_DECREF(array_module);
+        if (created == NULL) {
+            return NULL;
+        }
+        /* The import may have let another thread get here first */
+        if (*prototype == NULL) {
+            *prototype = created;
+        } else {
+            Py_DECREF(created);
+        }
+    }
+    return *prototype;
+}
+
+static int batch_takes_jdn(batch_kind_t kind) {
+    return kind == BATCH_JDN_TO_GREGORIAN || kind == BATCH_JDN_TO_ETHIOPIC;
+}
+
+static int batch_returns_jdn(batch_kind_t kind) {
+    return kind == BATCH_GREGORIAN_TO_JDN || kind == BATCH_ETHIOPIC_TO_JDN;
+}
+
+static int batch_takes_era(batch_kind_t kind) {
+    return kind == BATCH_ETHIOPIC_TO_GREGORIAN || kind == BATCH_ETHIOPIC_TO_JDN ||
+           kind == BATCH_JDN_TO_ETHIOPIC;
+}
+
+/**
+ * Runs a batch job; touches no Python objects, so it is called without the GIL.
+ * Invalid input dates give 0/0/0 in the date-to-date conversions.
+ */
+static void run_batch(const batch_job_t* job) {
+    int64_t jdn[BATCH_CHUNK];
+    int valid[BATCH_CHUNK];
+    size_t start, i;
+
+    switch (job->kind) {
+    case BATCH_GREGORIAN_TO_ETHIOPIC:
+        for (start = 0; start < job->n; start += BATCH_CHUNK) {
+            size_t count = (job->n - start < BATCH_CHUNK) ? job->n - start : BATCH_CHUNK;
+            const int32_t* y = job->in[0] + start;
+            const int32_t* m = job->in[1] + start;
+            const int32_t* d = job->in[2] + start;
+            for (i = 0; i < count; i++) {
+                valid[i] = is_valid_gregorian_date(y[i], m[i], d[i]);
+            }
+            gregorian_to_jdn_soa(y, m, d, jdn, count);
+            for (i = 0; i < count; i++) {
+                date_t date = jdn_to_ethiopic_fast(jdn[i], guess_era(jdn[i]));
+                job->out[0][start + i] = valid[i] ? date.year : 0;
+                job->out[1][start + i] = valid[i] ? date.month : 0;
+                job->out[2][start + i] = valid[i] ? date.day : 0;
+            }
+        }
+        break;
+
+    case BATCH_ETHIOPIC_TO_GREGORIAN:
+        for (start = 0; start < job->n; start += BATCH_CHUNK) {
+            size_t count = (job->n - start < BATCH_CHUNK) ? job->n - start : BATCH_CHUNK;
+            const int32_t* y = job->in[0] + start;
+            const int32_t* m = job->in[1] + start;
+            const int32_t* d = job->in[2] + start;
+            for (i = 0; i < count; i++) {
+                valid[i] = is_valid_ethiopic_date(y[i], m[i], d[i]);
+            }
+            ethiopic_to_jdn_soa(y, m, d, jdn, count, job->era);
+            for (i = 0; job->detect_era && i < count; i++) {
+                if (guess_era(jdn[i]) != JD_EPOCH_OFFSET_AMETE_MIHRET) {
+                    jdn[i] += JD_EPOCH_OFFSET_AMETE_ALEM - JD_EPOCH_OFFSET_AMETE_MIHRET;
+                }
+            }
+            jdn_to_gregorian_soa(jdn, job->out[0] + start, job->out[1] + start, job->out[2] + start, count);
+            for (i = 0; i < count; i++) {
+                if (!valid[i]) {
+                    job->out[0][start + i] = job->out[1][start + i] = job->out[2][start + i] = 0;
+                }
+            }
+        }
+        break;
+
+    case BATCH_GREGORIAN_TO_JDN:
+        gregorian_to_jdn_soa(job->in[0], job->in[1], job->in[2], job->out_jdn, job->n);
+        break;
+
+    case BATCH_ETHIOPIC_TO_JDN:
+        ethiopic_to_jdn_soa(job->in[0], job->in[1], job->in[2], job->out_jdn, job->n, job->era);
+        break;
+
+    case BATCH_JDN_TO_GREGORIAN:
+        jdn_to_gregorian_soa(job->in_jdn, job->out[0], job->out[1], job->out[2], job->n);
+        break;
+
+    case BATCH_JDN_TO_ETHIOPIC:
+        jdn_to_ethiopic_soa(job->in_jdn, job->out[0], job->out[1], job->out[2], job->n, job->era);
+        break;
+    }
+}
+
+/**
+ * Gets a C-contiguous buffer of signed integers of the given size (4 for date
+ * columns, 8 for JDN columns) and checks its length against *length, which is
+ * set by the first column (when it is -1). Returns 0 on success, -1 with an
+ * exception set.
+ */
+static int get_column(PyObject* obj, Py_ssize_t itemsize, int writable, Py_ssize_t* length,
+                      Py_buffer* view) {
+    const char* format;
+
+    if (PyObject_GetBuffer(obj, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT |
+                                      (writable ? PyBUF_WRITABLE : 0)) < 0) {
+        return -1;
+    }
+
+    format = view->format;
+    if (format != NULL && strchr("@=<>!", format[0]) != NULL) {
+        format++;
+    }
+    if (view->itemsize != itemsize || format == NULL || format[0] == '\0' || format[1] != '\0' ||
+        strchr("ilq", format[0]) == NULL) {
+        PyErr_Format(PyExc_TypeError, "expected a buffer of %s integers, e.g. array('%s')",
+                     itemsize == 4 ? "int32" : "int64", itemsize == 4 ? "i" : "q");
+        PyBuffer_Release(view);
+        return -1;
+    }
+
+    if (*length < 0) {
+        *length = view->len / itemsize;
+    } else if (view->len / itemsize != *length) {
+        PyErr_SetString(PyExc_ValueError, "all arrays must have the same length");
+        PyBuffer_Release(view);
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject* convert_batch(batch_kind_t kind, const char* func, const char* const* names,
+                               PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames) {
+    int nin = batch_takes_jdn(kind) ? 1 : 3;
+    int nout = batch_returns_jdn(kind) ? 1 : 3;
+    int has_era = batch_takes_era(kind);
+    Py_ssize_t count = nin + has_era + 1;
+    Py_ssize_t in_itemsize = batch_takes_jdn(kind) ? 8 : 4;
+    Py_ssize_t out_itemsize = batch_returns_jdn(kind) ? 8 : 4;
+    PyObject* values[5];
+    PyObject* outputs[3] = {NULL, NULL, NULL};
+    PyObject* out_arg;
+    PyObject* result = NULL;
+    Py_buffer in_views[3];
+    Py_buffer out_views[3];
+    int in_count = 0, out_count = 0;
+    Py_ssize_t length = -1;
+    batch_job_t job;
+    int k;
+
+    if (parse_args(func, names, count, nin, args, nargs, kwnames, values) < 0) {
+        return NULL;
+    }
+    job.kind = kind;
+    job.detect_era = (kind == BATCH_ETHIOPIC_TO_GREGORIAN) &&
+                     (values[nin] == NULL || values[nin] == Py_None);
+    if (has_era && as_era(values[nin], &job.era) < 0) {
+        return NULL;
+    }
+
+    for (; in_count < nin; in_count++) {
+        if (get_column(values[in_count], in_itemsize, 0, &length, &in_views[in_count]) < 0) {
+            goto done;
+        }
+    }
+
+    /* Outputs: a sequence of three columns (or one JDN column), or new arrays */
+    out_arg = values[count - 1];
+    for (k = 0; k < nout; k++) {
+        if (out_arg == NULL || out_arg == Py_None) {
+            PyObject* prototype = get_prototype(out_itemsize);
+            outputs[k] = prototype ? PySequence_Repeat(prototype, length) : NULL;
+        } else if (nout == 1) {
+            Py_INCREF(out_arg);
+            outputs[k] = out_arg;
+        } else if (PySequence_Check(out_arg) && PySequence_Size(out_arg) == 3) {
+            outputs[k] = PySequence_GetItem(out_arg, k);
+        } else {
+            PyErr_Format(PyExc_TypeError, "%s() out must be a sequence of 3 arrays", func);
+        }
+        if (outputs[k] == NULL ||
+            get_column(outputs[k], out_itemsize, 1, &length, &out_views[k]) < 0) {
+            goto done;
+        }
+        out_count++;
+    }
+
+    for (k = 0; k < 3; k++) {
+        job.in[k] = (k < nin && nin == 3) ? (const int32_t*)in_views[k].buf : NULL;
+        job.out[k] = (k < nout && nout == 3) ? (int32_t*)out_views[k].buf : NULL;
+    }
+    job.in_jdn = (nin == 1) ? (const int64_t*)in_views[0].buf : NULL;
+    job.out_jdn = (nout == 1) ? (int64_t*)out_views[0].buf : NULL;
+    job.n = (size_t)length;
+
+    /* The buffer exports keep the arrays from being resized or freed meanwhile */
+    Py_BEGIN_ALLOW_THREADS
+    run_batch(&job);
+    Py_END_ALLOW_THREADS
+
+    if (nout == 1) {
+        Py_INCREF(outputs[0]);
+        result = outputs[0];
+    } else {
+        result = PyTuple_Pack(3, outputs[0], outputs[1], outputs[2]);
+    }
+
+done:
+    while (in_count > 0) {
+        PyBuffer_Release(&in_views[--in_count]);
+    }
+    while (out_count > 0) {
+        PyBuffer_Release(&out_views[--out_count]);
+    }
+    for (k = 0; k < 3; k++) {
+        Py_XDECREF(outputs[k]);
+    }
+    return result;
+}
+
+static const char* const batch_date_names[] = {"years", "months", "days", "out"};
+static const char* const batch_date_era_names[] = {"years", "months", "days", "era", "out"};
+static const char* const batch_jdn_names[] = {"jdn", "out"};
+static const char* const batch_jdn_era_names[] = {"jdn", "era", "out"};
+
+#define DEFINE_BATCH(name, kind, names)                                                    \
+    static PyObject* native_##name(PyObject* self, PyObject* const* args,                 \
+                                   Py_ssize_t nargs, PyObject* kwnames) {                 \
+        (void)self;                                                                       \
+        return convert_batch(kind, #name, names, args, nargs, kwnames);                   \
+    }
+
+DEFINE_BATCH(gregorian_to_ethiopic_batch, BATCH_GREGORIAN_TO_ETHIOPIC, batch_date_names)
+DEFINE_BATCH(ethiopic_to_gregorian_batch, BATCH_ETHIOPIC_TO_GREGORIAN, batch_date_era_names)
+DEFINE_BATCH(gregorian_to_jdn_batch, BATCH_GREGORIAN_TO_JDN, batch_date_names)
+DEFINE_BATCH(ethiopic_to_jdn_batch, BATCH_ETHIOPIC_TO_JDN, batch_date_era_names)
+DEFINE_BATCH(jdn_to_gregorian_batch, BATCH_JDN_TO_GREGORIAN, batch_jdn_names)
+DEFINE_BATCH(jdn_to_ethiopic_batch, BATCH_JDN_TO_ETHIOPIC, batch_jdn_era_names)
+
+/** Whether the CPU and OS support the x86-64-v3 level the tuned build targets */
+static PyObject* native_supports_x86_64_v3(PyObject* self, PyObject* unused) {
+    int supported = 0;
+    (void)self;
+    (void)unused;
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    __builtin_cpu_init();
+    supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi") &&
+                __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("fma");
+#endif
+    return PyBool_FromLong(supported);
+}
+
+/*
+ * The NumPy ufunc module links its own copy of the core, whose holiday tables would
+ * never see load_islamic_holidays(). It calls this module's is_ethiopic_holiday
+ * instead, through a capsule holding a pointer to the function pointer below.
+ */
+static bool (*const holiday_lookup)(int64_t) = is_ethiopic_holiday;
+
+static PyObject* native__holiday_lookup(PyObject* self, PyObject* unused) {
+    (void)self;
+    (void)unused;
+    return PyCapsule_New((void*)&holiday_lookup, "ethiopian_date_converter.holiday_lookup", NULL);
+}
+
+#define NATIVE_METHOD(name, doc) \
+    {#name, (PyCFunction)(void (*)(void))native_##name, METH_FASTCALL | METH_KEYWORDS, doc}
+
+static PyMethodDef native_methods[] = {
+    NATIVE_METHOD(ethiopic_to_gregorian, "Convert Ethiopian date to Gregorian date."),
+    NATIVE_METHOD(gregorian_to_ethiopic, "Convert Gregorian date to Ethiopian date."),
+    NATIVE_METHOD(is_valid_ethiopic_date, "Check if an Ethiopian date is valid."),
+    NATIVE_METHOD(is_valid_gregorian_date, "Check if a Gregorian date is valid."),
+    NATIVE_METHOD(is_gregorian_leap, "Check if a Gregorian year is a leap year."),
+    NATIVE_METHOD(ethiopic_to_jdn, "Convert Ethiopian date to Julian Day Number."),
+    NATIVE_METHOD(gregorian_to_jdn, "Convert Gregorian date to Julian Day Number."),
+    NATIVE_METHOD(jdn_to_ethiopic, "Convert Julian Day Number to Ethiopian date."),
+    NATIVE_METHOD(jdn_to_gregorian, "Convert Julian Day Number to Gregorian date."),
+    NATIVE_METHOD(business_days_between, "Count Monday-Friday non-holiday days in a closed JDN range."),
+    NATIVE_METHOD(is_ethiopic_holiday, "Check if a JDN is an Ethiopian public holiday."),
+    NATIVE_METHOD(ethiopic_holiday_name, "Name of the holiday on a JDN, or None."),
+    NATIVE_METHOD(next_ethiopic_holiday, "(jdn, name) of the first holiday on or after a JDN."),
+    NATIVE_METHOD(next_ethiopic_holiday_after, "(jdn, name) of the first holiday after a JDN."),
+    NATIVE_METHOD(ethiopic_holidays_in_range, "[(jdn, name), ...] of the holidays in a closed JDN range."),
+    NATIVE_METHOD(ethiopic_easter, "JDN of Ethiopian Orthodox Easter (Fasika) in an Ethiopian year."),
+    NATIVE_METHOD(load_islamic_holidays, "Load the Islamic holiday table from a text file."),
+    NATIVE_METHOD(month_grid, "6x7 grid of days, JDNs and holiday names of a month."),
+    NATIVE_METHOD(gregorian_to_ethiopic_batch, "Convert int32 Gregorian date columns to Ethiopian columns."),
+    NATIVE_METHOD(ethiopic_to_gregorian_batch, "Convert int32 Ethiopian date columns to Gregorian columns."),
+    NATIVE_METHOD(gregorian_to_jdn_batch, "Convert int32 Gregorian date columns to an int64 JDN column."),
+    NATIVE_METHOD(ethiopic_to_jdn_batch, "Convert int32 Ethiopian date columns to an int64 JDN column."),
+    NATIVE_METHOD(jdn_to_gregorian_batch, "Convert an int64 JDN column to int32 Gregorian columns."),
+    NATIVE_METHOD(jdn_to_ethiopic_batch, "Convert an int64 JDN column to int32 Ethiopian columns."),
+    {"supports_x86_64_v3", native_supports_x86_64_v3, METH_NOARGS,
+     "Whether this CPU can run the x86-64-v3 build of this module."},
+    {"_holiday_lookup", native__holiday_lookup, METH_NOARGS,
+     "Capsule of this module's is_ethiopic_holiday, for the NumPy ufuncs."},
+    {NULL, NULL, 0, NULL}
+};
+
+static struct PyModuleDef native_module = {
+    PyModuleDef_HEAD_INIT,
+    "ethiopian_date_converter." NATIVE_NAME(NATIVE_MODULE),
+    "Native bindings to the Ethiopian calendar C core.",
+    -1,
+    native_methods
+};
+
+PyMODINIT_FUNC NATIVE_INIT_FUNC(NATIVE_MODULE)(void) {
+    key_year = PyUnicode_InternFromString("year");
+    key_month = PyUnicode_InternFromString("month");
+    key_day = PyUnicode_InternFromString("day");
+    if (key_year == NULL || key_month == NULL || key_day == NULL) {
+        return NULL;
+    }
+    return PyModule_Create(&native_module);
+}
@@ -0,0 +1,336 @@
+/*
+ * NumPy ufuncs over the C core's SoA batch kernels, plus is_ethiopic_holiday
+ * over the holiday bitmaps of the core converter.py uses.
+ *
+ * Each ufunc has an int32 and an int64 loop, so arrays of either type are used
+ * in place; smaller integer types are cast by NumPy. Broadcasting, out= and
+ * where= come from the ufunc machinery, which also releases the GIL around
+ * these loops since no object arrays are involved.
+ *
+ * Loops gather strided operands into fixed-size int32/int64 chunks, run the
+ * kernel, and scatter the results, so any strides (and outputs aliasing inputs)
+ * are fine. Date fields are int32 in the core; where the scalar API raises
+ * OverflowError, an int64 field outside that range makes its element invalid
+ * input, which gives 0 (0/0/0 for dates) or NaT from ethiopic_to_days.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#include <numpy/arrayobject.h>
+#include <numpy/ufuncobject.h>
+#include "ethiopic_calendar.h"
+
+#define UFUNC_CHUNK 256
+
+/* JDN of 1970-01-01, the zero of datetime64 day counts */
+#define UNIX_EPOCH_JDN 2440588
+
+typedef enum {
+    GREGORIAN_TO_ETHIOPIC,
+    ETHIOPIC_TO_GREGORIAN,
+    GREGORIAN_TO_JDN,
+    ETHIOPIC_TO_JDN,
+    JDN_TO_GREGORIAN,
+    JDN_TO_ETHIOPIC,
+    DAYS_TO_ETHIOPIC,
+    ETHIOPIC_TO_DAYS
+} conversion_t;
+
+/* Date operands are year/month/day triples; JDN and day-count operands are single columns */
+static int takes_jdn(conversion_t kind) {
+    return kind == JDN_TO_GREGORIAN || kind == JDN_TO_ETHIOPIC || kind == DAYS_TO_ETHIOPIC;
+}
+
+static int returns_jdn(conversion_t kind) {
+    return kind == GREGORIAN_TO_JDN || kind == ETHIOPIC_TO_JDN || kind == ETHIOPIC_TO_DAYS;
+}
+
+/* Day counts (datetime64[D] viewed as int64) are only registered with the int64 loop */
+static int uses_days(conversion_t kind) {
+    return kind == DAYS_TO_ETHIOPIC || kind == ETHIOPIC_TO_DAYS;
+}
+
+/**
+ * Converts one chunk. Invalid input dates produce 0/0/0, matching the Node
+ * batch functions; the era is detected per element where the scalar API
+ * detects it, and is Amete Mihret otherwise. Day counts map NaT to 0/0/0 and
+ * invalid dates to NaT.
+ */
+static void convert_chunk(conversion_t kind, int32_t in[3][UFUNC_CHUNK], int64_t* jdn,
+                          int32_t out[3][UFUNC_CHUNK], size_t n) {
+    size_t i;
+
+    switch (kind) {
+    case GREGORIAN_TO_ETHIOPIC:
+        gregorian_to_jdn_soa(in[0], in[1], in[2], jdn, n);
+        for (i = 0; i < n; i++) {
+            int valid = is_valid_gregorian_date(in[0][i], in[1][i], in[2][i]);
+            date_t date = jdn_to_ethiopic_fast(jdn[i], guess_era(jdn[i]));
+            out[0][i] = valid ? date.year : 0;
+            out[1][i] = valid ? date.month : 0;
+            out[2][i] = valid ? date.day : 0;
+        }
+        break;
+
+    case ETHIOPIC_TO_GREGORIAN:
+        ethiopic_to_jdn_soa(in[0], in[1], in[2], jdn, n, JD_EPOCH_OFFSET_AMETE_MIHRET);
+        for (i = 0; i < n; i++) {
+            if (guess_era(jdn[i]) != JD_EPOCH_OFFSET_AMETE_MIHRET) {
+                jdn[i] += JD_EPOCH_OFFSET_AMETE_ALEM - JD_EPOCH_OFFSET_AMETE_MIHRET;
+            }
+        }
+        jdn_to_gregorian_soa(jdn, out[0], out[1], out[2], n);
+        for (i = 0; i < n; i++) {
+            if (!is_valid_ethiopic_date(in[0][i], in[1][i], in[2][i])) {
+                out[0][i] = out[1][i] = out[2][i] = 0;
+            }
+        }
+        break;
+
+    case GREGORIAN_TO_JDN:
+        gregorian_to_jdn_soa(in[0], in[1], in[2], jdn, n);
+        break;
+
+    case ETHIOPIC_TO_JDN:
+        ethiopic_to_jdn_soa(in[0], in[1], in[2], jdn, n, JD_EPOCH_OFFSET_AMETE_MIHRET);
+        break;
+
+    case JDN_TO_GREGORIAN:
+        jdn_to_gregorian_soa(jdn, out[0], out[1], out[2], n);
+        break;
+
+    case JDN_TO_ETHIOPIC:
+        jdn_to_ethiopic_soa(jdn, out[0], out[1], out[2], n, JD_EPOCH_OFFSET_AMETE_MIHRET);
+        break;
+
+    case DAYS_TO_ETHIOPIC:
+        /* A Gregorian day, so the era is detected as in gregorian_to_ethiopic */
+        for (i = 0; i < n; i++) {
+            int64_t day_jdn = jdn[i] + UNIX_EPOCH_JDN;
+            date_t date = jdn_to_ethiopic_fast(day_jdn, guess_era(day_jdn));
+            int valid = jdn[i] != NPY_DATETIME_NAT;
+            out[0][i] = valid ? date.year : 0;
+            out[1][i] = valid ? date.month : 0;
+            out[2][i] = valid ? date.day : 0;
+        }
+        break;
+
+    case ETHIOPIC_TO_DAYS:
+        ethiopic_to_jdn_soa(in[0], in[1], in[2], jdn, n, JD_EPOCH_OFFSET_AMETE_MIHRET);
+        for (i = 0; i < n; i++) {
+            if (!is_valid_ethiopic_date(in[0][i], in[1][i], in[2][i])) {
+                jdn[i] = NPY_DATETIME_NAT;
+                continue;
+            }
+            if (guess_era(jdn[i]) != JD_EPOCH_OFFSET_AMETE_MIHRET) {
+                jdn[i] += JD_EPOCH_OFFSET_AMETE_ALEM - JD_EPOCH_OFFSET_AMETE_MIHRET;
+            }
+            jdn[i] -= UNIX_EPOCH_JDN;
+        }
+        break;
+    }
+}
+
+/* Defines the strided loop for one element type */
+#define DEFINE_CONVERT_LOOP(name, type)                                                          \
+    static void name(char** args, npy_intp const* dimensions, npy_intp const* steps,            \
+                     void* data) {                                                              \
+        conversion_t kind = *(const conversion_t*)data;                                         \
+        int nin = takes_jdn(kind) ? 1 : 3;                                                      \
+        int nout = returns_jdn(kind) ? 1 : 3;                                                   \
+        int32_t in[3][UFUNC_CHUNK];                                                             \
+        int32_t out[3][UFUNC_CHUNK];                                                            \
+        int64_t jdn[UFUNC_CHUNK];                                                               \
+        npy_bool fits[UFUNC_CHUNK];                                                             \
+        npy_intp start, i;                                                                      \
+        int k;                                                                                  \
+                                                                                                \
+        for (start = 0; start < dimensions[0]; start += UFUNC_CHUNK) {                          \
+            npy_intp count = dimensions[0] - start;                                             \
+            if (count > UFUNC_CHUNK) count = UFUNC_CHUNK;                                       \
+                                                                                                \
+            for (i = 0; i < count; i++) fits[i] = 1;                                            \
+            for (k = 0; k < nin; k++) {                                                         \
+                const char* src = args[k] + start * steps[k];                                   \
+                for (i = 0; i < count; i++, src += steps[k]) {                                  \
+                    type value = *(const type*)src;                                             \
+                    if (takes_jdn(kind)) {                                                      \
+                        jdn[i] = (int64_t)value;                                                \
+                    } else {                                                                    \
+                        in[k][i] = (int32_t)value;                                              \
+                        fits[i] &= (int64_t)in[k][i] == (int64_t)value;                         \
+                    }                                                                           \
+                }                                                                               \
+            }                                                                                   \
+                                                                                                \
+            convert_chunk(kind, in, jdn, out, (size_t)count);                                   \
+                                                                                                \
+            for (k = 0; k < nout; k++) {                                                        \
+                char* dst = args[nin + k] + start * steps[nin + k];                             \
+                for (i = 0; i < count; i++, dst += steps[nin + k]) {                            \
+                    if (!fits[i]) {                                                             \
+                        *(type*)dst = (kind == ETHIOPIC_TO_DAYS) ? (type)NPY_DATETIME_NAT : 0;  \
+                    } else {                                                                    \
+                        *(type*)dst = returns_jdn(kind) ? (type)jdn[i] : (type)out[k][i];       \
+                    }                                                                           \
+                }                                                                               \
+            }                                                                                   \
+        }                                                                                       \
+    }
+
+DEFINE_CONVERT_LOOP(convert_loop_int32, npy_int32)
+DEFINE_CONVERT_LOOP(convert_loop_int64, npy_int64)
+
+static PyUFuncGenericFunction convert_loops[] = {convert_loop_int32, convert_loop_int64};
+
+/*
+ * This module links its own copy of the core, but the holiday tables must be those
+ * load_islamic_holidays() fills: ethiopian_date_converter.np points holiday_lookup
+ * at the is_ethiopic_holiday of the backend converter.py uses, _native or ctypes.
+ */
+static bool (*holiday_lookup)(int64_t) = is_ethiopic_holiday;
+
+/* Defines the holiday test loop for one JDN type; each element is one bit test in the core */
+#define DEFINE_HOLIDAY_LOOP(name, type)                                                          \
+    static void name(char** args, npy_intp const* dimensions, npy_intp const* steps,            \
+                     void* data) {                                                              \
+        const char* src = args[0];                                                              \
+        char* dst = args[1];                                                                    \
+        npy_intp i;                                                                             \
+                                                                                                \
+        (void)data;                                                                             \
+        for (i = 0; i < dimensions[0]; i++, src += steps[0], dst += steps[1]) {                 \
+            *(npy_bool*)dst = holiday_lookup((int64_t)*(const type*)src);                       \
+        }                                                                                       \
+    }
+
+DEFINE_HOLIDAY_LOOP(holiday_loop_int32, npy_int32)
+DEFINE_HOLIDAY_LOOP(holiday_loop_int64, npy_int64)
+
+static PyUFuncGenericFunction holiday_loops[] = {holiday_loop_int32, holiday_loop_int64};
+static void* holiday_loop_data[] = {NULL, NULL};
+static char holiday_loop_types[] = {NPY_INT32, NPY_BOOL, NPY_INT64, NPY_BOOL};
+
+static const conversion_t conversions[] = {
+    GREGORIAN_TO_ETHIOPIC, ETHIOPIC_TO_GREGORIAN, GREGORIAN_TO_JDN,
+    ETHIOPIC_TO_JDN, JDN_TO_GREGORIAN, JDN_TO_ETHIOPIC,
+    DAYS_TO_ETHIOPIC, ETHIOPIC_TO_DAYS
+};
+
+#define UFUNC_COUNT (sizeof(conversions) / sizeof(conversions[0]))
+
+/* Loop data: the conversion, once per loop */
+static void* loop_data[UFUNC_COUNT][2];
+
+/* Operand types of the int32 loop followed by the int64 loop, for up to 3 + 3 operands */
+static char loop_types[UFUNC_COUNT][2 * 6];
+
+static const struct {
+    const char* name;
+    const char* doc;
+} ufunc_info[] = {
+    {"gregorian_to_ethiopic",
+     "gregorian_to_ethiopic(year, month, day) -> (year, month, day)\n\n"
+     "Convert Gregorian dates to Ethiopian dates; invalid dates give 0, 0, 0."},
+    {"ethiopic_to_gregorian",
+     "ethiopic_to_gregorian(year, month, day) -> (year, month, day)\n\n"
+     "Convert Ethiopian dates to Gregorian dates with per-element era detection;\n"
+     "invalid dates give 0, 0, 0."},
+    {"gregorian_to_jdn",
+     "gregorian_to_jdn(year, month, day) -> jdn\n\n"
+     "Convert Gregorian dates to Julian Day Numbers."},
+    {"ethiopic_to_jdn",
+     "ethiopic_to_jdn(year, month, day) -> jdn\n\n"
+     "Convert Amete Mihret dates to Julian Day Numbers."},
+    {"jdn_to_gregorian",
+     "jdn_to_gregorian(jdn) -> (year, month, day)\n\n"
+     "Convert Julian Day Numbers to Gregorian dates."},
+    {"jdn_to_ethiopic",
+     "jdn_to_ethiopic(jdn) -> (year, month, day)\n\n"
+     "Convert Julian Day Numbers to Amete Mihret dates."},
+    {"days_to_ethiopic",
+     "days_to_ethiopic(days) -> (year, month, day)\n\n"
+     "Convert int64 days since 1970-01-01 (datetime64[D] viewed as int64) to\n"
+     "Ethiopian dates; NaT gives 0, 0, 0."},
+    {"ethiopic_to_days",
+     "ethiopic_to_days(year, month, day) -> days\n\n"
+     "Convert Ethiopian dates to int64 days since 1970-01-01 with per-element era\n"
+     "detection; invalid dates give NaT."},
+};
+
+/* _use_holiday_lookup(capsule): the capsule holds a pointer to a function pointer */
+static PyObject* ufuncs_use_holiday_lookup(PyObject* self, PyObject* capsule) {
+    bool (**lookup)(int64_t);
+    (void)self;
+
+    lookup = (bool (**)(int64_t))PyCapsule_GetPointer(capsule, "ethiopian_date_converter.holiday_lookup");
+    if (lookup == NULL) {
+        return NULL;
+    }
+    holiday_lookup = *lookup;
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef ufuncs_methods[] = {
+    {"_use_holiday_lookup", ufuncs_use_holiday_lookup, METH_O,
+     "Make is_ethiopic_holiday call the core function in a converter._holiday_lookup() capsule."},
+    {NULL, NULL, 0, NULL}
+};
+
+static struct PyModuleDef ufuncs_module = {
+    PyModuleDef_HEAD_INIT,
+    "ethiopian_date_converter._ufuncs",
+    "NumPy ufuncs for Ethiopian calendar conversion.",
+    -1,
+    ufuncs_methods
+};
+
+PyMODINIT_FUNC PyInit__ufuncs(void) {
+    PyObject* module;
+    PyObject* holiday_ufunc;
+    size_t u;
+    int k;
+
+    import_array();
+    import_umath();
+
+    module = PyModule_Create(&ufuncs_module);
+    if (module == NULL) {
+        return NULL;
+    }
+
+    for (u = 0; u < UFUNC_COUNT; u++) {
+        int nin = takes_jdn(conversions[u]) ? 1 : 3;
+        int nout = returns_jdn(conversions[u]) ? 1 : 3;
+        int first = uses_days(conversions[u]) ? 1 : 0;
+        PyObject* ufunc;
+
+        for (k = 0; k < nin + nout; k++) {
+            loop_types[u][k] = NPY_INT32;
+            loop_types[u][nin + nout + k] = NPY_INT64;
+        }
+        loop_data[u][0] = loop_data[u][1] = (void*)&conversions[u];
+
+        ufunc = PyUFunc_FromFuncAndData(convert_loops + first, loop_data[u] + first,
+                                        loop_types[u] + first * (nin + nout), 2 - first, nin, nout,
+                                        PyUFunc_None, ufunc_info[u].name, ufunc_info[u].doc, 0);
+        if (ufunc == NULL || PyModule_AddObject(module, ufunc_info[u].name, ufunc) < 0) {
+            Py_XDECREF(ufunc);
+            Py_DECREF(module);
+            return NULL;
+        }
+    }
+
+    holiday_ufunc = PyUFunc_FromFuncAndData(holiday_loops, holiday_loop_data, holiday_loop_types, 2, 1, 1,
+                                            PyUFunc_None, "is_ethiopic_holiday",
+                                            "is_ethiopic_holiday(jdn) -> bool\n\n"
+                                            "Whether each Julian Day Number is an Ethiopian public holiday, fixed,\n"
+                                            "movable or loaded Islamic, as the scalar is_ethiopic_holiday.", 0);
+    if (holiday_ufunc == NULL || PyModule_AddObject(module, "is_ethiopic_holiday", holiday_ufunc) < 0) {
+        Py_XDECREF(holiday_ufunc);
+        Py_DECREF(module);
+        return NULL;
+    }
+    return module;
+}
@@ -40,10 +40,16 @@ ETHIOPIAN_HOLIDAYS = {
     "Ethiopian Christmas": (4, 29),
     "Epiphany (Timkat)": (5, 11),
     "Battle of Adwa": (6, 23),
+    "Palm Sunday": None,  # Variable date, a week before Easter
     "Good Friday": None,  # Variable date
     "Easter": None,       # Variable date
+    "Eid al-Fitr": None,  # Islamic, from load_islamic_holidays()
+    "Eid al-Adha": None,  # Islamic, from load_islamic_holidays()
+    "Mawlid": None,       # Islamic, from load_islamic_holidays()
 }
 
+ISLAMIC_HOLIDAYS = ("Eid al-Fitr", "Eid al-Adha", "Mawlid")
+
 # Calendar metadata
 ETHIOPIC_MONTHS_PER_YEAR = 13
 ETHIOPIC_DAYS_PER_MONTH = 30
@@ -1,135 +1,32 @@
 """
-Core conversion functions using native C implementation via ctypes.
+Core conversion functions using the native C implementation.
+
+The functions are provided by the compiled _native extension when it is built,
+and otherwise through ctypes, which loads the core as a shared library built with
+the package (or, for source checkouts, compiles it into the user cache directory).
+Set ETHIOPIAN_DATE_CONVERTER_CTYPES=1 to force the ctypes path.
+
+On x86-64 CPUs with AVX2, BMI2 and FMA, the _native_x86_64_v3 build of the
+extension is imported instead of the baseline one; set
+ETHIOPIAN_DATE_CONVERTER_BASELINE=1 to always use the baseline build.
 """
 
-import ctypes
+from __future__ import annotations
+
 import os
-import platform
-from typing import Dict, Tuple, Optional
-from ctypes import c_int32, c_int64, c_bool, Structure, POINTER
-
-class DateStruct(Structure):
-    """C date_t structure."""
-    _fields_ = [
-        ("year", c_int32),
-        ("month", c_int32),
-        ("day", c_int32),
-    ]
-
-class EthiopicCalendarLib:
-    """Wrapper for the native Ethiopian calendar C library."""
-    
-    def __init__(self):
-        self._lib = None
-        self._load_library()
-        self._setup_functions()
-    
-    def _load_library(self):
-        """Load the compiled C library."""
-        lib_dir = os.path.join(os.path.dirname(__file__), "core")
-        
-        # Try to find the compiled library
-        system = platform.system().lower()
-        if system == "windows":
-            lib_name = "ethiopic_calendar.dll"
-        elif system == "darwin":
-            lib_name = "libethiopic_calendar.dylib"
-        else:
-            lib_name = "libethiopic_calendar.so"
-        
-        lib_path = os.path.join(lib_dir, lib_name)
-        
-        if not os.path.exists(lib_path):
-            # Try to compile the library if it doesn't exist
-            self._compile_library(lib_dir, lib_name)
-        
-        try:
-            self._lib = ctypes.CDLL(lib_path)
-        except OSError as e:
-            raise ImportError(f"Could not load Ethiopian calendar library: {e}")
-    
-    def _compile_library(self, lib_dir: str, lib_name: str):
-        """Compile the C library on the fly."""
-        import subprocess
-        import tempfile
-        
-        c_file = os.path.join(lib_dir, "ethiopic_calendar.c")
-        lib_path = os.path.join(lib_dir, lib_name)
-        
-        if not os.path.exists(c_file):
-            raise FileNotFoundError(f"C source file not found: {c_file}")
-        
-        try:
-            system = platform.system().lower()
-            if system == "windows":
-                # Try to compile with gcc (MinGW) or cl (MSVC)
-                try:
-                    subprocess.run([
-                        "gcc", "-shared", "-fPIC", "-O3",
-                        "-o", lib_path, c_file
-                    ], check=True, capture_output=True)
-                except (subprocess.CalledProcessError, FileNotFoundError):
-                    subprocess.run([
-                        "cl", "/LD", "/O2", f"/Fe:{lib_path}", c_file
-                    ], check=True, capture_output=True)
-            else:
-                # Unix-like systems
-                subprocess.run([
-                    "gcc", "-shared", "-fPIC", "-O3",
-                    "-o", lib_path, c_file
-                ], check=True, capture_output=True)
-        except subprocess.CalledProcessError as e:
-            raise RuntimeError(f"Failed to compile C library: {e}")
-    
-    def _setup_functions(self):
-        """Setup function signatures for the C library."""
-        # is_gregorian_leap
-        self._lib.is_gregorian_leap.argtypes = [c_int32]
-        self._lib.is_gregorian_leap.restype = c_bool
-        
-        # is_valid_gregorian_date
-        self._lib.is_valid_gregorian_date.argtypes = [c_int32, c_int32, c_int32]
-        self._lib.is_valid_gregorian_date.restype = c_bool
-        
-        # is_valid_ethiopic_date
-        self._lib.is_valid_ethiopic_date.argtypes = [c_int32, c_int32, c_int32]
-        self._lib.is_valid_ethiopic_date.restype = c_bool
-        
-        # gregorian_to_jdn
-        self._lib.gregorian_to_jdn.argtypes = [c_int32, c_int32, c_int32]
-        self._lib.gregorian_to_jdn.restype = c_int64
-        
-        # ethiopic_to_jdn
-        self._lib.ethiopic_to_jdn.argtypes = [c_int32, c_int32, c_int32, c_int64]
-        self._lib.ethiopic_to_jdn.restype = c_int64
-        
-        # jdn_to_gregorian
-        self._lib.jdn_to_gregorian.argtypes = [c_int64]
-        self._lib.jdn_to_gregorian.restype = DateStruct
-        
-        # jdn_to_ethiopic
-        self._lib.jdn_to_ethiopic.argtypes = [c_int64, c_int64]
-        self._lib.jdn_to_ethiopic.restype = DateStruct
-        
-        # ethiopic_to_gregorian
-        self._lib.ethiopic_to_gregorian.argtypes = [c_int32, c_int32, c_int32, c_int64]
-        self._lib.ethiopic_to_gregorian.restype = DateStruct
-        
-        # gregorian_to_ethiopic
-        self._lib.gregorian_to_ethiopic.argtypes = [c_int32, c_int32, c_int32]
-        self._lib.gregorian_to_ethiopic.restype = DateStruct
-        
-        # guess_era
-        self._lib.guess_era.argtypes = [c_int64]
-        self._lib.guess_era.restype = c_int64
+
+TYPE_CHECKING = False  # typing.TYPE_CHECKING without importing typing
+if TYPE_CHECKING:
+    from typing import Dict, List, Optional, Tuple
 
 # Global library instance
 _lib = None
 
-def _get_lib() -> EthiopicCalendarLib:
-    """Get or create the library instance."""
+def _get_lib():
+    """Get or create the library instance; ctypes is only imported here."""
     global _lib
     if _lib is None:
+        from ._ctypes_lib import EthiopicCalendarLib
         _lib = EthiopicCalendarLib()
     return _lib
 
@@ -258,3 +155,292 @@ def get_day_of_week(jdn: int) -> int:
         0=Monday, 1=Tuesday, ..., 6=Sunday
     """
     return int(jdn % 7)
+
+def business_days_between(start_jdn: int, end_jdn: int, exclude_holidays: bool = True) -> int:
+    """
+    Count business days in a closed range of Julian Day Numbers, in constant time.
+    
+    Args:
+        start_jdn: First day of the range
+        end_jdn: Last day of the range (the two may be given in either order)
+        exclude_holidays: Also skip the Ethiopian public holidays
+    
+    Returns:
+        Number of days that fall Monday-Friday (and are not holidays)
+    """
+    lib = _get_lib()
+    return lib._lib.business_days_between(start_jdn, end_jdn, bool(exclude_holidays))
+
+def is_ethiopic_holiday(jdn: int) -> bool:
+    """Check if a Julian Day Number is an Ethiopian public holiday (one bitmap lookup)."""
+    lib = _get_lib()
+    return bool(lib._lib.is_ethiopic_holiday(jdn))
+
+def _holiday_name(lib, holiday_id: int) -> Optional[str]:
+    if holiday_id < 0:
+        return None
+    return lib._lib.ethiopic_holiday_name(holiday_id).decode("utf-8")
+
+def ethiopic_holiday_name(jdn: int) -> Optional[str]:
+    """Name of the Ethiopian public holiday on a Julian Day Number, or None."""
+    lib = _get_lib()
+    return _holiday_name(lib, lib._lib.ethiopic_holiday_id(jdn))
+
+def next_ethiopic_holiday(jdn: int) -> Tuple[int, str]:
+    """
+    Find the first Ethiopian public holiday on or after a Julian Day Number.
+    
+    Returns:
+        (jdn, name) of the holiday
+    """
+    from ctypes import byref, c_int32
+    lib = _get_lib()
+    holiday_id = c_int32()
+    holiday_jdn = lib._lib.ethiopic_next_holiday(jdn, byref(holiday_id))
+    return holiday_jdn, _holiday_name(lib, holiday_id.value)
+
+def next_ethiopic_holiday_after(jdn: int) -> Tuple[int, str]:
+    """
+    Find the first Ethiopian public holiday after a Julian Day Number, by a binary
+    search in the core's sorted holiday index.
+    
+    Returns:
+        (jdn, name) of the holiday
+    """
+    from ctypes import byref, c_int32
+    lib = _get_lib()
+    holiday_id = c_int32()
+    holiday_jdn = lib._lib.ethiopic_next_holiday_after(jdn, byref(holiday_id))
+    return holiday_jdn, _holiday_name(lib, holiday_id.value)
+
+def ethiopic_holidays_in_range(start_jdn: int, end_jdn: int) -> List[Tuple[int, str]]:
+    """
+    List the Ethiopian public holidays of a closed range of Julian Day Numbers.
+    
+    Args:
+        start_jdn: First day of the range
+        end_jdn: Last day of the range; an empty list when it is before start_jdn
+    
+    Returns:
+        (jdn, name) of each holiday, in date order
+    """
+    from ._ctypes_lib import DatedHolidayStruct
+    lib = _get_lib()
+    chunk = (DatedHolidayStruct * 64)()
+    holidays = []
+    while True:
+        written = lib._lib.ethiopic_holidays_in_range(start_jdn, end_jdn, chunk, 64)
+        holidays.extend((chunk[i].jdn, _holiday_name(lib, chunk[i].id)) for i in range(written))
+        if written < 64:
+            return holidays
+        start_jdn = chunk[written - 1].jdn + 1
+
+def ethiopic_easter(year: int) -> int:
+    """Julian Day Number of Ethiopian Orthodox Easter (Fasika) in an Ethiopian year."""
+    lib = _get_lib()
+    return lib._lib.ethiopic_easter(year)
+
+def load_islamic_holidays(path) -> int:
+    """
+    Load the Islamic holiday table used by the holiday and business day functions.
+    
+    Islamic holidays depend on the sighting of the moon, so they come from a text
+    file with one "YYYY-MM-DD Name" line (Gregorian date) per holiday, where Name is
+    "Eid al-Fitr", "Eid al-Adha" or "Mawlid"; lines starting with # are comments.
+    The table replaces the previous one; load it before other threads use holidays.
+    
+    Returns:
+        Number of holidays loaded
+    """
+    lib = _get_lib()
+    result = lib._lib.ethiopic_load_islamic_holidays(os.fsencode(path))
+    # ETHIOPIC_HOLIDAY_ERROR_IO, _FORMAT and _MEMORY of ethiopic_calendar.h
+    if result == -1:
+        raise OSError(f"cannot read Islamic holiday file {path!r}")
+    if result == -2:
+        raise ValueError(f"invalid Islamic holiday file {path!r}")
+    if result == -3:
+        raise MemoryError()
+    return result
+
+def _holiday_lookup():
+    """Capsule of the core's is_ethiopic_holiday, so the NumPy ufuncs share its holiday tables."""
+    return _get_lib().holiday_lookup_capsule()
+
+def month_grid(year: int, month: int, calendar: str = "ethiopic") -> Dict[str, object]:
+    """
+    Build the 6x7 grid of a month view in the C core, Monday first.
+    
+    Args:
+        year: Year (Amete Mihret for Ethiopian months)
+        month: Month (1-13 for "ethiopic", 1-12 for "gregorian")
+        calendar: "ethiopic" or "gregorian"
+    
+    Returns:
+        Dictionary with 'year', 'month', 'calendar', 'days_in_month', 'first_weekday'
+        (column of day 1), 'weeks' (rows holding days of the month), and 'days', 'jdns'
+        and 'holidays': six row tuples of seven cells each. Cells of the adjacent months
+        have day 0; 'holidays' holds the holiday name of each cell, or None.
+    
+    Raises:
+        ValueError: If the month or calendar is invalid
+    """
+    from ._ctypes_lib import MonthGridStruct
+    if calendar not in ("ethiopic", "gregorian"):
+        raise ValueError("calendar must be 'ethiopic' or 'gregorian'")
+    lib = _get_lib()
+    grid = MonthGridStruct()
+    if not lib._lib.ethiopic_month_grid(calendar == "gregorian", year, month, grid):
+        raise ValueError(f"Invalid {calendar} month: {year}-{month}")
+    return {
+        "year": year,
+        "month": month,
+        "calendar": calendar,
+        "days_in_month": grid.days_in_month,
+        "first_weekday": grid.first_weekday,
+        "weeks": grid.weeks,
+        "days": tuple(tuple(row) for row in grid.day),
+        "jdns": tuple(tuple(row) for row in grid.jdn),
+        "holidays": tuple(tuple(_holiday_name(lib, holiday_id) for holiday_id in row) for row in grid.holiday),
+    }
+
+# Batch conversions over int32 date columns and int64 JDN columns: array.array('i') /
+# array.array('q'), NumPy arrays, or any other buffer of that type. The extension module
+# converts without holding the GIL; these ctypes versions loop over the scalar functions.
+
+def _check_lengths(*columns) -> int:
+    if len({len(column) for column in columns}) > 1:
+        raise ValueError("all arrays must have the same length")
+    return len(columns[0])
+
+def _outputs(out, count: int, typecode: str, length: int):
+    if out is None:
+        from array import array
+        itemsize = array(typecode).itemsize
+        out = tuple(array(typecode, bytes(itemsize * length)) for _ in range(count))
+        return out if count > 1 else out[0]
+    _check_lengths(*((out,) if count == 1 else out), range(length))
+    return out
+
+def _convert_dates(convert, is_valid, years, months, days, out):
+    out = _outputs(out, 3, "i", _check_lengths(years, months, days))
+    for i, (year, month, day) in enumerate(zip(years, months, days)):
+        date = convert(year, month, day) if is_valid(year, month, day) else {"year": 0, "month": 0, "day": 0}
+        out[0][i], out[1][i], out[2][i] = date["year"], date["month"], date["day"]
+    return out
+
+def gregorian_to_ethiopic_batch(years, months, days, out=None):
+    """Convert int32 Gregorian date columns to Ethiopian columns; invalid dates give 0, 0, 0."""
+    return _convert_dates(gregorian_to_ethiopic, is_valid_gregorian_date, years, months, days, out)
+
+def ethiopic_to_gregorian_batch(years, months, days, era=None, out=None):
+    """Convert int32 Ethiopian date columns to Gregorian columns; invalid dates give 0, 0, 0."""
+    convert = lambda year, month, day: ethiopic_to_gregorian(year, month, day, era)
+    return _convert_dates(convert, is_valid_ethiopic_date, years, months, days, out)
+
+def gregorian_to_jdn_batch(years, months, days, out=None):
+    """Convert int32 Gregorian date columns to an int64 JDN column."""
+    out = _outputs(out, 1, "q", _check_lengths(years, months, days))
+    for i, (year, month, day) in enumerate(zip(years, months, days)):
+        out[i] = gregorian_to_jdn(year, month, day)
+    return out
+
+def ethiopic_to_jdn_batch(years, months, days, era=None, out=None):
+    """Convert int32 Ethiopian date columns to an int64 JDN column."""
+    out = _outputs(out, 1, "q", _check_lengths(years, months, days))
+    for i, (year, month, day) in enumerate(zip(years, months, days)):
+        out[i] = ethiopic_to_jdn(year, month, day, era)
+    return out
+
+def jdn_to_gregorian_batch(jdn, out=None):
+    """Convert an int64 JDN column to int32 Gregorian columns."""
+    out = _outputs(out, 3, "i", len(jdn))
+    for i, value in enumerate(jdn):
+        date = jdn_to_gregorian(value)
+        out[0][i], out[1][i], out[2][i] = date["year"], date["month"], date["day"]
+    return out
+
+def jdn_to_ethiopic_batch(jdn, era=None, out=None):
+    """Convert an int64 JDN column to int32 Ethiopian columns."""
+    out = _outputs(out, 3, "i", len(jdn))
+    for i, value in enumerate(jdn):
+        date = jdn_to_ethiopic(value, era)
+        out[0][i], out[1][i], out[2][i] = date["year"], date["month"], date["day"]
+    return out
+
+# Replace the ctypes functions above with the extension module when available
+_NATIVE_FUNCTIONS = (
+    "ethiopic_to_gregorian",
+    "gregorian_to_ethiopic",
+    "is_valid_ethiopic_date",
+    "is_valid_gregorian_date",
+    "is_gregorian_leap",
+    "ethiopic_to_jdn",
+    "gregorian_to_jdn",
+    "jdn_to_ethiopic",
+    "jdn_to_gregorian",
+    "business_days_between",
+    "is_ethiopic_holiday",
+    "ethiopic_holiday_name",
+    "next_ethiopic_holiday",
+    "next_ethiopic_holiday_after",
+    "ethiopic_holidays_in_range",
+    "ethiopic_easter",
+    "load_islamic_holidays",
+    "_holiday_lookup",
+    "month_grid",
+    "gregorian_to_ethiopic_batch",
+    "ethiopic_to_gregorian_batch",
+    "gregorian_to_jdn_batch",
+    "ethiopic_to_jdn_batch",
+    "jdn_to_gregorian_batch",
+    "jdn_to_ethiopic_batch",
+)
+
+def _load_native():
+    """The extension module build for this CPU and its variant name."""
+    from . import _native
+    if not os.environ.get("ETHIOPIAN_DATE_CONVERTER_BASELINE") and _native.supports_x86_64_v3():
+        try:
+            from . import _native_x86_64_v3
+            return _native_x86_64_v3, "x86-64-v3"
+        except ImportError:
+            pass
+    return _native, "baseline"
+
+try:
+    if os.environ.get("ETHIOPIAN_DATE_CONVERTER_CTYPES"):
+        raise ImportError("ctypes backend requested")
+    _module, NATIVE_VARIANT = _load_native()
+    globals().update((name, getattr(_module, name)) for name in _NATIVE_FUNCTIONS)
+    del _module
+    BACKEND = "native"
+except ImportError:
+    NATIVE_VARIANT = None
+    BACKEND = "ctypes"
+
+# A calendar UI renders the same few months over and over, so the grids of the most
+# recent ones are kept, read-only. functools is imported on first use to keep the
+# package import light; a new Islamic holiday table empties the cache.
+_MONTH_GRID_CACHE_SIZE = 32
+_cached_month_grid = None
+_load_islamic_holidays = load_islamic_holidays
+
+def cached_month_grid(year: int, month: int, calendar: str = "ethiopic"):
+    """month_grid() through an LRU cache of recent months; the result is a shared read-only mapping."""
+    global _cached_month_grid
+    if _cached_month_grid is None:
+        from functools import lru_cache
+        from types import MappingProxyType
+        _cached_month_grid = lru_cache(maxsize=_MONTH_GRID_CACHE_SIZE)(
+            lambda year, month, calendar: MappingProxyType(month_grid(year, month, calendar)))
+    return _cached_month_grid(year, month, calendar)
+
+def load_islamic_holidays(path) -> int:
+    try:
+        return _load_islamic_holidays(path)
+    finally:
+        if _cached_month_grid is not None:
+            _cached_month_grid.cache_clear()
+
+load_islamic_holidays.__doc__ = _load_islamic_holidays.__doc__
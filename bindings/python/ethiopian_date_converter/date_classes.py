@@ -15,8 +15,10 @@ from .converter import (
     jdn_to_ethiopic,
     jdn_to_gregorian,
     get_day_of_week,
+    is_ethiopic_holiday,
+    ethiopic_holiday_name,
 )
-from .constants import ETHIOPIC_MONTHS, GREGORIAN_MONTHS, WEEKDAYS, ETHIOPIAN_HOLIDAYS
+from .constants import ETHIOPIC_MONTHS, GREGORIAN_MONTHS, WEEKDAYS
 
 class InvalidDateError(ValueError):
     """Raised when an invalid date is provided."""
@@ -135,17 +137,11 @@ class EthiopicDate:
     
     def is_holiday(self) -> bool:
         """Check if the date is a holiday."""
-        for holiday, date_tuple in ETHIOPIAN_HOLIDAYS.items():
-            if date_tuple and date_tuple == (self.month, self.day):
-                return True
-        return False
+        return is_ethiopic_holiday(self.to_jdn())
     
     def get_holiday_name(self) -> Optional[str]:
         """Get holiday name if the date is a holiday."""
-        for holiday, date_tuple in ETHIOPIAN_HOLIDAYS.items():
-            if date_tuple and date_tuple == (self.month, self.day):
-                return holiday
-        return None
+        return ethiopic_holiday_name(self.to_jdn())
     
     def format(self, format_string: str = "YYYY-MM-DD", locale: str = "en") -> str:
         """
@@ -0,0 +1,86 @@
+"""
+NumPy ufuncs for Ethiopian calendar conversion.
+
+Each function is a real ``numpy.ufunc`` over int32 or int64 arrays, backed by the
+C core's batch kernels: it broadcasts its inputs, accepts ``out=`` and ``where=``,
+and runs without the GIL. Date ufuncs return ``(year, month, day)`` arrays of the
+input dtype; invalid input dates give ``0, 0, 0`` rather than raising.
+
+    >>> import numpy as np
+    >>> from ethiopian_date_converter import np as ednp
+    >>> ednp.gregorian_to_ethiopic(np.array([2024, 2025]), np.array([9, 1]), np.array([11, 7]))
+    (array([2017, 2017]), array([1, 4]), array([ 1, 29]))
+
+``ethiopic_to_jdn`` and ``jdn_to_ethiopic`` use the Amete Mihret era, like their
+scalar counterparts without an era; ``ethiopic_to_gregorian`` detects the era per
+element, like the scalar ``ethiopic_to_gregorian``.
+
+``datetime64_to_ethiopic`` and ``ethiopic_to_datetime64`` convert ``datetime64[D]``
+arrays, which are day counts from 1970-01-01, directly to and from Ethiopian
+components without Python ``datetime`` objects.
+
+``is_ethiopic_holiday`` tests a JDN array against the core's holiday bitmaps, so
+it sees the movable feasts and loaded Islamic holidays like the scalar function.
+"""
+
+try:
+    import numpy
+    from ._ufuncs import (
+        gregorian_to_ethiopic,
+        ethiopic_to_gregorian,
+        gregorian_to_jdn,
+        ethiopic_to_jdn,
+        jdn_to_gregorian,
+        jdn_to_ethiopic,
+        days_to_ethiopic,
+        ethiopic_to_days,
+        is_ethiopic_holiday,
+    )
+except ImportError as e:
+    raise ImportError(
+        "ethiopian_date_converter.np requires NumPy and the _ufuncs extension; "
+        "install with: pip install ethiopian-date-converter-py[numpy]"
+    ) from e
+
+from . import _ufuncs, converter as _converter
+
+# Holidays are looked up in the core the scalar functions use, so loaded Islamic
+# holidays are seen by the ufunc too
+_ufuncs._use_holiday_lookup(_converter._holiday_lookup())
+
+
+def datetime64_to_ethiopic(dates, out=None):
+    """
+    Convert a ``datetime64`` array to Ethiopian ``(year, month, day)`` int64 arrays.
+    
+    ``datetime64[D]`` input is reinterpreted as int64 day counts without a copy;
+    other units (e.g. the ``datetime64[ns]`` of pandas columns) are first cast to
+    days, flooring to the calendar day. NaT gives ``0, 0, 0``.
+    """
+    dates = numpy.asarray(dates)
+    if dates.dtype != numpy.dtype("datetime64[D]"):
+        dates = dates.astype("datetime64[D]")
+    return days_to_ethiopic(dates.view(numpy.int64), out=out)
+
+def ethiopic_to_datetime64(year, month, day):
+    """
+    Convert Ethiopian date arrays to a ``datetime64[D]`` array.
+    
+    The era is detected per element as in ``ethiopic_to_gregorian``; invalid
+    dates give NaT.
+    """
+    return ethiopic_to_days(year, month, day).view("datetime64[D]")
+
+__all__ = [
+    "gregorian_to_ethiopic",
+    "ethiopic_to_gregorian",
+    "gregorian_to_jdn",
+    "ethiopic_to_jdn",
+    "jdn_to_gregorian",
+    "jdn_to_ethiopic",
+    "days_to_ethiopic",
+    "ethiopic_to_days",
+    "is_ethiopic_holiday",
+    "datetime64_to_ethiopic",
+    "ethiopic_to_datetime64",
+]
@@ -0,0 +1,108 @@
+"""
+pandas ``.ethiopic`` Series accessor.
+
+Importing this module registers ``Series.ethiopic`` for Series of ``datetime64``
+values (Gregorian days, time of day ignored) or of ``EthiopicDate`` objects:
+
+    >>> import pandas as pd
+    >>> import ethiopian_date_converter.pandas
+    >>> s = pd.Series(pd.to_datetime(["2024-09-11", "2025-01-07"]))
+    >>> s.ethiopic.year.tolist(), s.ethiopic.month_name().tolist()
+    ([2017, 2017], ['Meskerem', 'Tahsas'])
+
+Whole columns go through the NumPy ufuncs in ``ethiopian_date_converter.np``.
+pandas creates the accessor once per Series object, and the accessor converts on
+first use and keeps the result, so reading several fields converts only once.
+Modifying a Series in place does not refresh an accessor already created for it.
+"""
+
+import numpy
+import pandas
+
+from . import np as ednp
+from .constants import ETHIOPIC_MONTHS
+from .date_classes import EthiopicDate
+
+@pandas.api.extensions.register_series_accessor("ethiopic")
+class EthiopicAccessor:
+    """Ethiopian calendar fields of a datetime64 or EthiopicDate Series."""
+
+    def __init__(self, series: pandas.Series):
+        if isinstance(series.dtype, pandas.DatetimeTZDtype):
+            # Convert the local wall-clock day, as .dt.day does
+            series = series.dt.tz_localize(None)
+        elif not pandas.api.types.is_datetime64_dtype(series.dtype) and not (
+            series.dtype == object and
+            all(isinstance(value, EthiopicDate) or pandas.isna(value) for value in series)
+        ):
+            raise AttributeError("Can only use .ethiopic accessor with datetime64 or EthiopicDate values")
+
+        self._series = series
+        self._fields = None
+
+    def _convert(self):
+        """Ethiopian (year, month, day) int64 arrays and the missing-value mask, computed once."""
+        if self._fields is None:
+            values = self._series.to_numpy()
+            if values.dtype == object:
+                missing = pandas.isna(values)
+                year, month, day = (numpy.zeros(len(values), numpy.int64) for _ in range(3))
+                present = values[~missing]
+                year[~missing] = [date.year for date in present]
+                month[~missing] = [date.month for date in present]
+                day[~missing] = [date.day for date in present]
+            else:
+                year, month, day = ednp.datetime64_to_ethiopic(values)
+                missing = numpy.isnat(values)
+            self._fields = (year, month, day, missing)
+        return self._fields
+
+    def _wrap(self, values, missing=None) -> pandas.Series:
+        """A Series on the original index; int32 like .dt fields, or float64 with NaN for NaT."""
+        if missing is not None:
+            if missing.any():
+                values = numpy.where(missing, numpy.nan, values)
+            else:
+                values = values.astype(numpy.int32)
+        return pandas.Series(values, index=self._series.index, name=self._series.name)
+
+    @property
+    def year(self) -> pandas.Series:
+        """Ethiopian year."""
+        year, _, _, missing = self._convert()
+        return self._wrap(year, missing)
+
+    @property
+    def month(self) -> pandas.Series:
+        """Ethiopian month (1-13)."""
+        _, month, _, missing = self._convert()
+        return self._wrap(month, missing)
+
+    @property
+    def day(self) -> pandas.Series:
+        """Ethiopian day of the month."""
+        _, _, day, missing = self._convert()
+        return self._wrap(day, missing)
+
+    def month_name(self, locale: str = "en") -> pandas.Series:
+        """Ethiopian month names in the given locale ("en" or "am"); NaN for missing values."""
+        _, month, _, missing = self._convert()
+        names = numpy.array([numpy.nan] + ETHIOPIC_MONTHS[locale], dtype=object)
+        return self._wrap(names[numpy.where(missing, 0, month)])
+
+    @property
+    def is_holiday(self) -> pandas.Series:
+        """Whether each date is an Ethiopian public holiday, as EthiopicDate.is_holiday(); False for missing values."""
+        year, month, day, missing = self._convert()
+        holidays = ednp.is_ethiopic_holiday(ednp.ethiopic_to_jdn(year, month, day))
+        return self._wrap(holidays & ~missing)
+
+    def to_gregorian(self) -> pandas.Series:
+        """The Gregorian day of each value as datetime64; time of day and time zone are dropped."""
+        values = self._series.to_numpy()
+        if values.dtype != object:
+            days = values.astype("datetime64[D]")
+        else:
+            year, month, day, _ = self._convert()
+            days = ednp.ethiopic_to_datetime64(year, month, day)
+        return self._wrap(days.astype("datetime64[ns]"))
@@ -4,8 +4,12 @@ Utility functions for Ethiopian calendar operations.
 
 from datetime import datetime
 from typing import List, Dict, Any, Tuple, Optional
+from .converter import (
+    business_days_between, cached_month_grid, ethiopic_to_jdn, ethiopic_holidays_in_range,
+    next_ethiopic_holiday_after
+)
 from .date_classes import EthiopicDate, GregorianDate
-from .constants import ETHIOPIAN_HOLIDAYS
+from .constants import ETHIOPIAN_HOLIDAYS, ETHIOPIC_MONTHS, GREGORIAN_MONTHS, ISLAMIC_HOLIDAYS
 
 def get_current_ethiopic_date() -> EthiopicDate:
     """Get the current Ethiopian date."""
@@ -30,70 +34,43 @@ def generate_calendar(year: int, month: int, calendar_type: str = "ethiopic") ->
     if calendar_type == "ethiopic":
         if month < 1 or month > 13:
             raise ValueError("Ethiopian month must be between 1 and 13")
-        
-        # Get number of days in the month
-        if month == 13:  # Pagume
-            days_in_month = 6 if ((year % 4) == 3) else 5
-        else:
-            days_in_month = 30
-        
-        # Get first day of month
-        first_day = EthiopicDate(year, month, 1)
-        first_day_jdn = first_day.to_jdn()
-        first_weekday = first_day_jdn % 7  # 0=Monday
-        
-        # Generate calendar grid
-        calendar_grid = []
-        current_week = [None] * 7
-        
-        # Fill in empty days at the beginning
-        for i in range(first_weekday):
-            current_week[i] = None
-        
-        # Fill in the days of the month
-        for day in range(1, days_in_month + 1):
-            week_day = (first_weekday + day - 1) % 7
-            current_week[week_day] = day
-            
-            if week_day == 6:  # End of week
-                calendar_grid.append(current_week)
-                current_week = [None] * 7
-        
-        # Add the last week if it has any days
-        if any(day is not None for day in current_week):
-            calendar_grid.append(current_week)
-        
-        return {
-            "year": year,
-            "month": month,
-            "calendar_type": "ethiopic",
-            "month_name": EthiopicDate(year, month, 1).get_month_name(),
-            "days_in_month": days_in_month,
-            "calendar_grid": calendar_grid,
-            "holidays": get_holidays_in_month(year, month, "ethiopic")
-        }
-    
     elif calendar_type == "gregorian":
         if month < 1 or month > 12:
             raise ValueError("Gregorian month must be between 1 and 12")
-        
-        # Standard Gregorian calendar generation logic
-        # This is a simplified version - you might want to use Python's calendar module
-        import calendar
-        
-        cal = calendar.monthcalendar(year, month)
-        
+    else:
+        raise ValueError("calendar_type must be 'ethiopic' or 'gregorian'")
+    
+    # The grid comes from the C core, through the cache of recently rendered months
+    grid = cached_month_grid(year, month, calendar_type)
+    rows = grid["days"][:grid["weeks"]]
+    
+    if calendar_type == "ethiopic":
+        holidays = [
+            _holiday_dict(EthiopicDate(year, month, day), name)
+            for day_row, name_row in zip(rows, grid["holidays"])
+            for day, name in zip(day_row, name_row)
+            if day and name is not None
+        ]
         return {
             "year": year,
             "month": month,
-            "calendar_type": "gregorian",
-            "month_name": GregorianDate(year, month, 1).get_month_name(),
-            "calendar_grid": cal,
-            "holidays": get_holidays_in_month(year, month, "gregorian")
+            "calendar_type": "ethiopic",
+            "month_name": ETHIOPIC_MONTHS["en"][month - 1],
+            "days_in_month": grid["days_in_month"],
+            # Days outside the month are None, as before
+            "calendar_grid": [[day or None for day in row] for row in rows],
+            "holidays": holidays
         }
     
-    else:
-        raise ValueError("calendar_type must be 'ethiopic' or 'gregorian'")
+    return {
+        "year": year,
+        "month": month,
+        "calendar_type": "gregorian",
+        "month_name": GREGORIAN_MONTHS["en"][month - 1],
+        # Days outside the month are 0, like calendar.monthcalendar()
+        "calendar_grid": [list(row) for row in rows],
+        "holidays": get_holidays_in_month(year, month, "gregorian")
+    }
 
 def get_business_days(start_date: EthiopicDate, end_date: EthiopicDate, 
                      exclude_holidays: bool = True) -> int:
@@ -108,26 +85,8 @@ def get_business_days(start_date: EthiopicDate, end_date: EthiopicDate,
     Returns:
         Number of business days
     """
-    if start_date > end_date:
-        start_date, end_date = end_date, start_date
-    
-    business_days = 0
-    current_date = start_date
-    
-    while current_date <= end_date:
-        # Check if it's a weekday (Monday=0, Sunday=6)
-        day_of_week = current_date.to_jdn() % 7
-        is_weekday = day_of_week < 5  # Monday to Friday
-        
-        # Check if it's a holiday
-        is_holiday = exclude_holidays and current_date.is_holiday()
-        
-        if is_weekday and not is_holiday:
-            business_days += 1
-        
-        current_date = current_date.add_days(1)
-    
-    return business_days
+    # Counted in the C core in constant time, whatever the length of the range
+    return business_days_between(start_date.to_jdn(), end_date.to_jdn(), exclude_holidays)
 
 def get_holidays(year: int, calendar_type: str = "ethiopic") -> List[Dict[str, Any]]:
     """
@@ -140,31 +99,39 @@ def get_holidays(year: int, calendar_type: str = "ethiopic") -> List[Dict[str, A
     Returns:
         List of holiday dictionaries
     """
-    holidays = []
-    
-    if calendar_type == "ethiopic":
-        for holiday_name, date_tuple in ETHIOPIAN_HOLIDAYS.items():
-            if date_tuple:  # Fixed date holidays
-                month, day = date_tuple
-                try:
-                    holiday_date = EthiopicDate(year, month, day)
-                    holidays.append({
-                        "name": holiday_name,
-                        "date": holiday_date,
-                        "month": month,
-                        "day": day,
-                        "type": "fixed"
-                    })
-                except:
-                    # Invalid date for this year (shouldn't happen for fixed holidays)
-                    continue
-    
-    return holidays
+    if calendar_type != "ethiopic":
+        return []
+    return _holidays_between(ethiopic_to_jdn(year, 1, 1), ethiopic_to_jdn(year + 1, 1, 1) - 1)
 
 def get_holidays_in_month(year: int, month: int, calendar_type: str = "ethiopic") -> List[Dict[str, Any]]:
     """Get holidays in a specific month."""
-    all_holidays = get_holidays(year, calendar_type)
-    return [h for h in all_holidays if h["month"] == month]
+    if calendar_type != "ethiopic":
+        return []
+    # Only the month's own days are looked up, not the whole year
+    start_jdn = ethiopic_to_jdn(year, month, 1)
+    return _holidays_between(start_jdn, start_jdn + EthiopicDate(year, month, 1).get_days_in_month() - 1)
+
+def _holidays_between(start_jdn: int, end_jdn: int) -> List[Dict[str, Any]]:
+    """Holiday dictionaries of a closed JDN range, from the core's sorted holiday index."""
+    return [
+        _holiday_dict(EthiopicDate.from_jdn(jdn), name) for jdn, name in ethiopic_holidays_in_range(start_jdn, end_jdn)
+    ]
+
+def _holiday_dict(holiday_date: EthiopicDate, holiday_name: str) -> Dict[str, Any]:
+    """Holiday dictionary of get_holidays."""
+    if ETHIOPIAN_HOLIDAYS.get(holiday_name):
+        holiday_type = "fixed"
+    elif holiday_name in ISLAMIC_HOLIDAYS:
+        holiday_type = "islamic"
+    else:
+        holiday_type = "movable"
+    return {
+        "name": holiday_name,
+        "date": holiday_date,
+        "month": holiday_date.month,
+        "day": holiday_date.day,
+        "type": holiday_type
+    }
 
 def calculate_age(birth_date: EthiopicDate, reference_date: Optional[EthiopicDate] = None) -> Dict[str, int]:
     """
@@ -222,15 +189,15 @@ def find_next_holiday(start_date: EthiopicDate, max_days: int = 365) -> Optional
     Returns:
         Holiday information or None if no holiday found
     """
-    current_date = start_date.add_days(1)
-    
-    for _ in range(max_days):
-        if current_date.is_holiday():
-            return {
-                "name": current_date.get_holiday_name(),
-                "date": current_date,
-                "days_until": current_date.diff_days(start_date)
-            }
-        current_date = current_date.add_days(1)
-    
-    return None
+    # A binary search in the core's sorted holiday index rather than a day-by-day walk
+    start_jdn = start_date.to_jdn()
+    holiday_jdn, name = next_ethiopic_holiday_after(start_jdn)
+    days_until = holiday_jdn - start_jdn
+    
+    if days_until > max_days:
+        return None
+    return {
+        "name": name,
+        "date": EthiopicDate.from_jdn(holiday_jdn),
+        "days_until": days_until
+    }
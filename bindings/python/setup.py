@@ -2,11 +2,12 @@
 Setup script for ethiopian-date-converter package.
 """
 
+import json
 import os
 import platform
+import shutil
 from setuptools import setup, find_packages, Extension
 from setuptools.command.build_ext import build_ext
-import subprocess
 
 # Read version from __init__.py
 def get_version():
@@ -24,58 +25,182 @@ def get_long_description():
     except FileNotFoundError:
         return "Ethiopian calendar date conversion for Python"
 
+# The C core lives in core/ at the repository root; the package carries a copy
+# so that sdists and wheels build without the rest of the repository
+REPO_CORE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "core")
+PACKAGE_CORE_DIR = os.path.join("ethiopian_date_converter", "core")
+
+def vendor_core():
+    """Copy the shared C core and its build flags into the package."""
+    flags_path = os.path.join(REPO_CORE_DIR, "build-flags.json")
+    if not os.path.exists(flags_path):
+        # Building from an sdist, which already carries the copy
+        return
+    
+    with open(flags_path, "r") as f:
+        flags = json.load(f)
+    
+    os.makedirs(PACKAGE_CORE_DIR, exist_ok=True)
+    shutil.copy2(flags_path, PACKAGE_CORE_DIR)
+    for include_dir in flags["include_dirs"]:
+        target_dir = os.path.join(PACKAGE_CORE_DIR, include_dir)
+        os.makedirs(target_dir, exist_ok=True)
+        for name in os.listdir(os.path.join(REPO_CORE_DIR, include_dir)):
+            if name.endswith((".c", ".h")):
+                shutil.copy2(os.path.join(REPO_CORE_DIR, include_dir, name), target_dir)
+
+def load_build_flags():
+    """Read the compiler flags shared with the CMake build and the JS/TS bindings."""
+    with open(os.path.join(PACKAGE_CORE_DIR, "build-flags.json"), "r") as f:
+        return json.load(f)
+
+# Core functions the ctypes fallback calls; exported explicitly for MSVC
+CTYPES_SYMBOLS = [
+    "is_gregorian_leap", "is_valid_gregorian_date", "is_valid_ethiopic_date",
+    "gregorian_to_jdn", "ethiopic_to_jdn", "jdn_to_gregorian", "jdn_to_ethiopic",
+    "ethiopic_to_gregorian", "gregorian_to_ethiopic", "guess_era", "business_days_between",
+    "is_ethiopic_holiday", "ethiopic_holiday_id", "ethiopic_holiday_name", "ethiopic_next_holiday",
+    "ethiopic_next_holiday_after", "ethiopic_holidays_in_range",
+    "ethiopic_easter", "ethiopic_load_islamic_holidays", "ethiopic_month_grid",
+]
+
+# x86-64-v3 (Haswell and later) spelled out for compilers without -march=x86-64-v3
+X86_64_V3_CFLAGS = ["-mavx2", "-mbmi", "-mbmi2", "-mfma", "-mf16c", "-mlzcnt", "-mmovbe"]
+TUNED_MODULE = "ethiopian_date_converter._native_x86_64_v3"
+
+def shared_library_name() -> str:
+    """File name of the core shared library loaded by the ctypes fallback."""
+    system = platform.system().lower()
+    if system == "windows":
+        return "ethiopic_calendar.dll"
+    elif system == "darwin":
+        return "libethiopic_calendar.dylib"
+    return "libethiopic_calendar.so"
+
 class CustomBuildExt(build_ext):
-    """Custom build extension to compile the C library."""
+    """Builds the extension modules and the ctypes fallback library into the build tree.
     
-    def build_extensions(self):
-        # Build the shared library first
-        self.build_shared_library()
-        super().build_extensions()
+    Everything is compiled here, at wheel build time, so installing a wheel never
+    runs a compiler and importing the package never writes into site-packages.
+    """
     
-    def build_shared_library(self):
-        """Build the shared C library."""
-        c_file = os.path.join("ethiopian_date_converter", "core", "ethiopic_calendar.c")
-        
-        if not os.path.exists(c_file):
-            raise FileNotFoundError(f"C source file not found: {c_file}")
-        
-        # Determine library name and compilation command
-        system = platform.system().lower()
-        if system == "windows":
-            lib_name = "ethiopic_calendar.dll"
-            compile_cmd = ["gcc", "-shared", "-fPIC", "-O3", "-o"]
-        elif system == "darwin":
-            lib_name = "libethiopic_calendar.dylib"
-            compile_cmd = ["gcc", "-shared", "-fPIC", "-O3", "-o"]
+    def build_extensions(self):
+        flags = load_build_flags()
+        if self.compiler.compiler_type == "msvc":
+            compile_args = flags["msvc_cflags"]
         else:
-            lib_name = "libethiopic_calendar.so"
-            compile_cmd = ["gcc", "-shared", "-fPIC", "-O3", "-o"]
+            compile_args = flags["cflags"] + flags["optimize_cflags"]
         
-        lib_path = os.path.join("ethiopian_date_converter", "core", lib_name)
+        if not self.targets_x86_64():
+            self.extensions = [ext for ext in self.extensions if ext.name != TUNED_MODULE]
+        for ext in self.extensions:
+            ext.extra_compile_args = compile_args + ext.extra_compile_args
+        super().build_extensions()
         
-        # Skip if library already exists
+        # Built last so a missing compiler fails the optional extensions first
+        self.build_shared_library(compile_args)
+    
+    def targets_x86_64(self) -> bool:
+        """Whether the tuned x86-64-v3 module can be built for this target."""
+        if self.compiler.compiler_type == "msvc":
+            return False
+        if platform.machine().lower() not in ("x86_64", "amd64"):
+            return False
+        # macOS universal2 and arm64 builds cross-compile from x86-64 hosts
+        return "arm64" not in os.environ.get("ARCHFLAGS", "")
+    
+    def shared_library_path(self) -> str:
+        """Where the shared library is built: core/ of the package in the build tree."""
+        return os.path.join(self.build_lib, "ethiopian_date_converter", "core", shared_library_name())
+    
+    def copy_extensions_to_source(self):
+        # build_ext --inplace builds into build/ and copies back; include the library
+        super().copy_extensions_to_source()
+        lib_path = self.shared_library_path()
         if os.path.exists(lib_path):
-            return
+            self.copy_file(lib_path, os.path.join(PACKAGE_CORE_DIR, shared_library_name()))
+    
+    def build_shared_library(self, compile_args):
+        """Build the shared C library next to the built extension modules."""
+        flags = load_build_flags()
+        sources = [os.path.join(PACKAGE_CORE_DIR, source) for source in flags["sources"]]
+        
+        for c_file in sources:
+            if not os.path.exists(c_file):
+                raise FileNotFoundError(f"C source file not found: {c_file}")
+        
+        lib_path = self.shared_library_path()
         
-        # Compile the library
         try:
-            cmd = compile_cmd + [lib_path, c_file]
-            subprocess.run(cmd, check=True, capture_output=True)
-            print(f"Successfully compiled {lib_name}")
-        except subprocess.CalledProcessError as e:
+            objects = self.compiler.compile(
+                sources,
+                output_dir=self.build_temp,
+                include_dirs=[os.path.join(PACKAGE_CORE_DIR, d) for d in flags["include_dirs"]],
+                extra_postargs=compile_args,
+            )
+            self.compiler.link_shared_object(
+                objects, lib_path,
+                export_symbols=CTYPES_SYMBOLS if self.compiler.compiler_type == "msvc" else None,
+            )
+            print(f"Successfully compiled {os.path.basename(lib_path)}")
+        except Exception as e:
+            # The native extension does not need it; only the ctypes fallback does
             print(f"Warning: Failed to compile C library: {e}")
-            print("The package will attempt to compile at runtime.")
-        except FileNotFoundError:
-            print("Warning: GCC not found. The package will attempt to compile at runtime.")
 
-# Define package data to include C source files and compiled libraries
+def native_extensions():
+    """The CPython extension module, compiled together with the core sources.
+    
+    On x86-64 the same source is also built as an x86-64-v3 variant, which
+    converter.py imports instead when the CPU supports it.
+    """
+    flags = load_build_flags()
+    sources = ([os.path.join("ethiopian_date_converter", "_native.c")] +
+               [os.path.join(PACKAGE_CORE_DIR, source) for source in flags["sources"]])
+    include_dirs = [os.path.join(PACKAGE_CORE_DIR, d) for d in flags["include_dirs"]]
+    return [
+        Extension(
+            "ethiopian_date_converter._native",
+            sources=sources,
+            include_dirs=include_dirs,
+            # Without a compiler the package still works through ctypes
+            optional=True,
+        ),
+        Extension(
+            TUNED_MODULE,
+            sources=sources,
+            include_dirs=include_dirs,
+            define_macros=[("NATIVE_MODULE", "_native_x86_64_v3")],
+            extra_compile_args=X86_64_V3_CFLAGS,
+            optional=True,
+        ),
+    ]
+
+def numpy_extension():
+    """The NumPy ufunc module; only built when NumPy is available."""
+    try:
+        import numpy
+    except ImportError:
+        return None
+    
+    flags = load_build_flags()
+    return Extension(
+        "ethiopian_date_converter._ufuncs",
+        sources=[os.path.join("ethiopian_date_converter", "_ufuncs.c")] +
+                [os.path.join(PACKAGE_CORE_DIR, source) for source in flags["sources"]],
+        include_dirs=[os.path.join(PACKAGE_CORE_DIR, d) for d in flags["include_dirs"]] +
+                     [numpy.get_include()],
+        optional=True,
+    )
+
+vendor_core()
+
+# Define package data to include the C sources; compiled libraries are placed
+# in the build tree by CustomBuildExt
 package_data = {
     "ethiopian_date_converter": [
-        "core/*.c",
-        "core/*.h",
-        "core/*.dll",
-        "core/*.so", 
-        "core/*.dylib",
+        "core/build-flags.json",
+        "core/src/*.c",
+        "core/src/*.h",
     ]
 }
 
@@ -95,6 +220,7 @@ setup(
     },
     packages=find_packages(),
     package_data=package_data,
+    ext_modules=native_extensions() + [ext for ext in (numpy_extension(),) if ext is not None],
     include_package_data=True,
     classifiers=[
         "Development Status :: 5 - Production/Stable",
@@ -122,6 +248,7 @@ setup(
         # No external dependencies - uses only Python standard library
     ],
     extras_require={
+        "numpy": ["numpy>=1.19"],
         "dev": [
             "pytest>=6.0",
             "pytest-cov>=2.0",
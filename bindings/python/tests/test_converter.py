@@ -2,7 +2,13 @@
 Test cases for Ethiopian date converter core functions.
 """
 
+import os
+import subprocess
+import sys
 import pytest
+from array import array
+from concurrent.futures import ThreadPoolExecutor
+from ethiopian_date_converter import converter
 from ethiopian_date_converter import (
     ethiopic_to_gregorian,
     gregorian_to_ethiopic,
@@ -14,6 +20,22 @@ from ethiopian_date_converter import (
     jdn_to_ethiopic,
     jdn_to_gregorian,
     get_day_of_week,
+    business_days_between,
+    is_ethiopic_holiday,
+    ethiopic_holiday_name,
+    next_ethiopic_holiday,
+    next_ethiopic_holiday_after,
+    ethiopic_holidays_in_range,
+    ethiopic_easter,
+    load_islamic_holidays,
+    month_grid,
+    cached_month_grid,
+    gregorian_to_ethiopic_batch,
+    ethiopic_to_gregorian_batch,
+    gregorian_to_jdn_batch,
+    ethiopic_to_jdn_batch,
+    jdn_to_gregorian_batch,
+    jdn_to_ethiopic_batch,
 )
 
 class TestBasicConversion:
@@ -192,3 +214,327 @@ class TestEdgeCases:
         jdn1 = ethiopic_to_jdn(2017, 1, 30)
         jdn2 = ethiopic_to_jdn(2017, 2, 1)
         assert jdn2 == jdn1 + 1
+
+class TestNativeExtension:
+    """Test the extension module against the ctypes fallback."""
+    
+    def test_matches_ctypes(self):
+        """Test that both backends agree across a wide range of dates."""
+        native = pytest.importorskip("ethiopian_date_converter._native")
+        lib = converter._get_lib()._lib
+        
+        def fields(date):
+            return {"year": date.year, "month": date.month, "day": date.day}
+        
+        for jdn in range(1000000, 3000000, 997):
+            g = native.jdn_to_gregorian(jdn)
+            assert g == fields(lib.jdn_to_gregorian(jdn))
+            for era in (converter.JD_EPOCH_OFFSET_AMETE_MIHRET, converter.JD_EPOCH_OFFSET_AMETE_ALEM):
+                e = native.jdn_to_ethiopic(jdn, era)
+                assert e == fields(lib.jdn_to_ethiopic(jdn, era))
+                assert native.ethiopic_to_jdn(e["year"], e["month"], e["day"], era=era) == jdn
+            assert native.gregorian_to_jdn(**g) == jdn
+            assert native.gregorian_to_ethiopic(**g) == fields(lib.gregorian_to_ethiopic(g["year"], g["month"], g["day"]))
+    
+    def test_argument_errors(self):
+        """Test argument checking in the extension module."""
+        native = pytest.importorskip("ethiopian_date_converter._native")
+        with pytest.raises(TypeError):
+            native.gregorian_to_jdn(2024, 9)
+        with pytest.raises(TypeError):
+            native.ethiopic_to_jdn(2017, 1, 1, calendar=1)
+        with pytest.raises(OverflowError):
+            native.gregorian_to_jdn(2**40, 1, 1)
+        with pytest.raises(ValueError):
+            native.ethiopic_to_gregorian(2016, 13, 6)
+    
+    def test_tuned_variant_matches_baseline(self):
+        """Test that the x86-64-v3 build, when loaded, agrees with the baseline build."""
+        native = pytest.importorskip("ethiopian_date_converter._native")
+        if not native.supports_x86_64_v3():
+            pytest.skip("CPU does not support x86-64-v3")
+        tuned = pytest.importorskip("ethiopian_date_converter._native_x86_64_v3")
+        assert converter.NATIVE_VARIANT in ("x86-64-v3", "baseline", None)
+        
+        jdn = array("q", range(1000000, 3000000, 997))
+        assert tuned.jdn_to_ethiopic_batch(jdn) == native.jdn_to_ethiopic_batch(jdn)
+        assert tuned.jdn_to_gregorian_batch(jdn) == native.jdn_to_gregorian_batch(jdn)
+
+class TestBusinessDays:
+    """Test the constant-time business day count."""
+    
+    def test_matches_day_by_day_count(self):
+        """Test against counting weekdays and holidays one day at a time."""
+        holidays = {(1, 1), (1, 17), (4, 29), (5, 11), (6, 23)}
+        good_fridays = {ethiopic_easter(year) - 2 for year in range(2009, 2020)}
+        start = ethiopic_to_jdn(2010, 1, 1)
+        for first in range(start, start + 3000, 37):
+            last = first + (first * 7919) % 900
+            weekdays = [jdn for jdn in range(first, last + 1) if jdn % 7 < 5]
+            non_holidays = [jdn for jdn in weekdays if jdn not in good_fridays and
+                            tuple(jdn_to_ethiopic(jdn).values())[1:] not in holidays]
+            assert business_days_between(first, last, exclude_holidays=False) == len(weekdays)
+            assert business_days_between(first, last) == len(non_holidays)
+            assert business_days_between(last, first) == len(non_holidays)
+    
+    def test_get_business_days(self):
+        """Test the EthiopicDate helper in utils."""
+        from ethiopian_date_converter.date_classes import EthiopicDate
+        from ethiopian_date_converter.utils import get_business_days
+        # Meskerem 2017 starts on a Wednesday; 1 and 17 Meskerem are holidays
+        start, end = EthiopicDate(2017, 1, 1), EthiopicDate(2017, 1, 30)
+        assert get_business_days(start, end, exclude_holidays=False) == 22
+        assert get_business_days(start, end) == 20
+        assert get_business_days(end, start) == 20
+
+class TestHolidays:
+    """Test the bitmap-backed holiday lookups."""
+    
+    def test_matches_holiday_table(self):
+        """Test every day of four years against ETHIOPIAN_HOLIDAYS and the Easter dates."""
+        from ethiopian_date_converter.constants import ETHIOPIAN_HOLIDAYS
+        names = {date: name for name, date in ETHIOPIAN_HOLIDAYS.items() if date}
+        start = ethiopic_to_jdn(2014, 1, 1)
+        for year in range(2014, 2019):
+            easter = ethiopic_easter(year)
+            names.update({easter - 7: "Palm Sunday", easter - 2: "Good Friday", easter: "Easter"})
+        for jdn in range(start, start + 4 * 366):
+            date = jdn_to_ethiopic(jdn)
+            name = names.get((date["month"], date["day"]), names.get(jdn))
+            assert is_ethiopic_holiday(jdn) == (name is not None)
+            assert ethiopic_holiday_name(jdn) == name
+    
+    def test_next_holiday(self):
+        """Test the first holiday on or after a JDN."""
+        new_year = ethiopic_to_jdn(2017, 1, 1)
+        assert next_ethiopic_holiday(new_year) == (new_year, "Ethiopian New Year")
+        assert next_ethiopic_holiday(new_year + 1) == (new_year + 16, "Finding of the True Cross")
+        # From the last day of Pagume 2015 (a leap year) to 1 Meskerem 2016
+        pagume_6 = ethiopic_to_jdn(2015, 13, 6)
+        assert next_ethiopic_holiday(pagume_6) == (pagume_6 + 1, "Ethiopian New Year")
+        assert next_ethiopic_holiday_after(new_year) == (new_year + 16, "Finding of the True Cross")
+        assert next_ethiopic_holiday_after(pagume_6 - 1) == (pagume_6 + 1, "Ethiopian New Year")
+    
+    def test_holidays_in_range(self):
+        """Test range queries against next_ethiopic_holiday, inside and past the index window."""
+        for start, end in [(ethiopic_to_jdn(2017, 1, 1), ethiopic_to_jdn(2017, 1, 17)),
+                           (ethiopic_to_jdn(1800, 1, 1), ethiopic_to_jdn(2200, 1, 1))]:
+            expected = []
+            holiday = next_ethiopic_holiday(start)
+            while holiday[0] <= end:
+                expected.append(holiday)
+                holiday = next_ethiopic_holiday_after(holiday[0])
+            assert ethiopic_holidays_in_range(start, end) == expected
+        assert len(ethiopic_holidays_in_range(ethiopic_to_jdn(2017, 1, 1), ethiopic_to_jdn(2017, 1, 17))) == 2
+        assert ethiopic_holidays_in_range(ethiopic_to_jdn(2017, 1, 2), ethiopic_to_jdn(2017, 1, 16)) == []
+        assert ethiopic_holidays_in_range(ethiopic_to_jdn(2017, 1, 17), ethiopic_to_jdn(2017, 1, 1)) == []
+    
+    def test_date_class_and_utils(self):
+        """Test EthiopicDate.is_holiday and find_next_holiday."""
+        from ethiopian_date_converter.date_classes import EthiopicDate
+        from ethiopian_date_converter.utils import find_next_holiday
+        assert EthiopicDate(2017, 4, 29).is_holiday()
+        assert EthiopicDate(2017, 4, 29).get_holiday_name() == "Ethiopian Christmas"
+        assert not EthiopicDate(2017, 4, 28).is_holiday()
+        assert EthiopicDate(2017, 4, 28).get_holiday_name() is None
+        
+        holiday = find_next_holiday(EthiopicDate(2017, 4, 29))
+        assert holiday["name"] == "Epiphany (Timkat)"
+        assert holiday["date"] == EthiopicDate(2017, 5, 11)
+        assert holiday["days_until"] == 12
+        assert find_next_holiday(EthiopicDate(2017, 4, 29), max_days=11) is None
+        assert find_next_holiday(EthiopicDate(2017, 4, 29), max_days=12) is not None
+    
+    def test_get_holidays_in_month(self):
+        """Test the holidays of single months, including Pagume."""
+        from ethiopian_date_converter.utils import get_holidays_in_month
+        assert [h["day"] for h in get_holidays_in_month(2017, 1)] == [1, 17]
+        assert [h["name"] for h in get_holidays_in_month(2017, 8)] == ["Palm Sunday", "Good Friday", "Easter"]
+        assert get_holidays_in_month(2015, 13) == []
+        assert get_holidays_in_month(2017, 1, "gregorian") == []
+
+class TestMovableHolidays:
+    """Test the movable feasts and the Islamic holiday table."""
+    
+    def test_easter(self):
+        """Test Fasika against its Gregorian dates."""
+        dates = [(2020, 4, 19), (2021, 5, 2), (2022, 4, 24), (2023, 4, 16),
+                 (2024, 5, 5), (2025, 4, 20), (2026, 4, 12)]
+        for year, date in zip(range(2012, 2019), dates):
+            easter = ethiopic_easter(year)
+            assert easter == gregorian_to_jdn(*date)
+            assert get_day_of_week(easter) == 6
+            assert ethiopic_holiday_name(easter - 2) == "Good Friday"
+            assert ethiopic_holiday_name(easter - 7) == "Palm Sunday"
+    
+    def test_get_holidays_includes_movable_feasts(self):
+        """Test that get_holidays lists Easter and Good Friday in date order."""
+        from ethiopian_date_converter.utils import get_holidays
+        holidays = get_holidays(2017)
+        assert [h["name"] for h in holidays] == [
+            "Ethiopian New Year", "Finding of the True Cross", "Ethiopian Christmas",
+            "Epiphany (Timkat)", "Battle of Adwa", "Palm Sunday", "Good Friday", "Easter",
+        ]
+        easter = holidays[-1]
+        assert (easter["month"], easter["day"], easter["type"]) == (8, 12, "movable")
+        assert holidays[0]["type"] == "fixed"
+    
+    def test_islamic_holiday_file(self, tmp_path):
+        """Test loading, using and clearing an Islamic holiday table."""
+        from ethiopian_date_converter.utils import get_holidays
+        path = tmp_path / "islamic_holidays.txt"
+        path.write_text("# Islamic holidays\n2025-03-30 Eid al-Fitr\n2025-06-06 Eid al-Adha\n")
+        eid = gregorian_to_jdn(2025, 3, 30)
+        try:
+            assert load_islamic_holidays(path) == 2
+            assert ethiopic_holiday_name(eid) == "Eid al-Fitr"
+            assert next_ethiopic_holiday(eid - 5) == (eid, "Eid al-Fitr")
+            # Eid al-Fitr 2025 is a Sunday; Eid al-Adha 2025 a Friday
+            assert business_days_between(eid, eid + 70) == 50 - 2
+            types = {h["name"]: h["type"] for h in get_holidays(2017)}
+            assert types["Eid al-Adha"] == "islamic"
+            
+            path.write_text("2025-03-30 New Year\n")
+            with pytest.raises(ValueError):
+                load_islamic_holidays(path)
+            with pytest.raises(OSError):
+                load_islamic_holidays(tmp_path / "missing.txt")
+            assert ethiopic_holiday_name(eid) == "Eid al-Fitr"
+        finally:
+            path.write_text("")
+            assert load_islamic_holidays(path) == 0
+        assert not is_ethiopic_holiday(eid)
+
+class TestMonthGrid:
+    """Test the month grids of the C core and their cache."""
+    
+    def test_grid_cells(self):
+        """Test every cell of a year of Ethiopian and Gregorian months."""
+        for calendar, months, to_date in [("ethiopic", 13, jdn_to_ethiopic), ("gregorian", 12, jdn_to_gregorian)]:
+            for month in range(1, months + 1):
+                grid = month_grid(2017, month, calendar)
+                days = 0
+                for week in range(6):
+                    for weekday in range(7):
+                        jdn = grid["jdns"][week][weekday]
+                        date = to_date(jdn)
+                        in_month = (date["year"], date["month"]) == (2017, month)
+                        assert get_day_of_week(jdn) == weekday
+                        assert grid["days"][week][weekday] == (date["day"] if in_month else 0)
+                        assert grid["holidays"][week][weekday] == ethiopic_holiday_name(jdn)
+                        days += in_month
+                assert days == grid["days_in_month"]
+        assert month_grid(2015, 13)["days_in_month"] == 6
+        assert month_grid(2016, 13)["days_in_month"] == 5
+        with pytest.raises(ValueError):
+            month_grid(2017, 14)
+        with pytest.raises(ValueError):
+            month_grid(2017, 1, "julian")
+    
+    def test_cache(self, tmp_path):
+        """Test that cached grids are shared, read-only and dropped with the Islamic table."""
+        grid = cached_month_grid(2017, 7)
+        assert cached_month_grid(2017, 7) is grid
+        assert dict(grid) == month_grid(2017, 7)
+        with pytest.raises(TypeError):
+            grid["weeks"] = 0
+        path = tmp_path / "islamic_holidays.txt"
+        path.write_text("2025-03-30 Eid al-Fitr\n")
+        try:
+            load_islamic_holidays(path)
+            assert "Eid al-Fitr" in sum(cached_month_grid(2017, 7)["holidays"], ())
+        finally:
+            path.write_text("")
+            load_islamic_holidays(path)
+        assert "Eid al-Fitr" not in sum(cached_month_grid(2017, 7)["holidays"], ())
+    
+    def test_generate_calendar(self):
+        """Test the calendar views built from the grid."""
+        from ethiopian_date_converter.utils import generate_calendar
+        calendar = generate_calendar(2017, 1)
+        assert calendar["calendar_grid"][0] == [None, None, 1, 2, 3, 4, 5]
+        assert len(calendar["calendar_grid"]) == 5
+        assert [(h["day"], h["name"]) for h in calendar["holidays"]] == [
+            (1, "Ethiopian New Year"), (17, "Finding of the True Cross")]
+        pagume = generate_calendar(2015, 13)
+        assert pagume["days_in_month"] == 6 and pagume["month_name"] == "Pagume"
+        import calendar as stdlib_calendar
+        assert generate_calendar(2024, 2, "gregorian")["calendar_grid"] == stdlib_calendar.monthcalendar(2024, 2)
+
+class TestLazyImport:
+    """Test that importing the package defers its submodules to first use."""
+    
+    def run_fresh(self, code):
+        package_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+        result = subprocess.run([sys.executable, "-c", code], cwd=package_dir,
+                                check=True, capture_output=True, text=True)
+        return result.stdout.split()
+    
+    def test_import_loads_nothing(self):
+        """Test that a bare import loads no submodule, C core, ctypes or datetime."""
+        loaded = self.run_fresh(
+            "import sys, ethiopian_date_converter\n"
+            "print(*sorted(m for m in sys.modules if m.startswith('ethiopian_date_converter.')))\n"
+            "print('ctypes' in sys.modules, 'datetime' in sys.modules)"
+        )
+        assert loaded == ["False", "False"]
+    
+    def test_first_use_loads_only_what_it_needs(self):
+        """Test that a conversion loads the converter but not the date classes."""
+        loaded = self.run_fresh(
+            "import sys, ethiopian_date_converter as e\n"
+            "assert e.gregorian_to_ethiopic(2024, 9, 11) == {'year': 2017, 'month': 1, 'day': 1}\n"
+            "print('ethiopian_date_converter.converter' in sys.modules,\n"
+            "      'ethiopian_date_converter.date_classes' in sys.modules)"
+        )
+        assert loaded == ["True", "False"]
+    
+    def test_public_names(self):
+        """Test that every name in __all__ resolves and unknown names still fail."""
+        import ethiopian_date_converter
+        for name in ethiopian_date_converter.__all__:
+            assert getattr(ethiopian_date_converter, name) is not None
+            assert name in dir(ethiopian_date_converter)
+        with pytest.raises(AttributeError):
+            ethiopian_date_converter.not_a_function
+
+class TestBatchConversion:
+    """Test the batch functions over array.array columns."""
+    
+    JDN = array("q", range(2400000, 2500000, 7))
+    
+    def test_jdn_round_trips(self):
+        """Test JDN -> date columns -> JDN in both calendars."""
+        gy, gm, gd = jdn_to_gregorian_batch(self.JDN)
+        ey, em, ed = jdn_to_ethiopic_batch(self.JDN)
+        assert gregorian_to_jdn_batch(gy, gm, gd) == self.JDN
+        assert ethiopic_to_jdn_batch(ey, em, ed) == self.JDN
+    
+    def test_matches_scalar_functions(self):
+        """Test the date-to-date batches against the scalar functions."""
+        gy, gm, gd = jdn_to_gregorian_batch(self.JDN)
+        ey, em, ed = gregorian_to_ethiopic_batch(gy, gm, gd)
+        by, bm, bd = ethiopic_to_gregorian_batch(ey, em, ed)
+        assert (by, bm, bd) == (gy, gm, gd)
+        for i in range(0, len(self.JDN), 97):
+            assert gregorian_to_ethiopic(gy[i], gm[i], gd[i]) == {"year": ey[i], "month": em[i], "day": ed[i]}
+    
+    def test_in_place_and_invalid(self):
+        """Test converting into the input arrays, with an invalid date."""
+        y, m, d = array("i", [2024, 2023]), array("i", [9, 2]), array("i", [11, 29])
+        result = gregorian_to_ethiopic_batch(y, m, d, out=(y, m, d))
+        assert result[0] is y
+        assert (list(y), list(m), list(d)) == ([2017, 0], [1, 0], [1, 0])
+    
+    def test_mismatched_lengths(self):
+        """Test that columns of different lengths raise ValueError."""
+        with pytest.raises(ValueError):
+            gregorian_to_jdn_batch(array("i", [2024]), array("i", [9]), array("i", [11, 12]))
+    
+    def test_threads(self):
+        """Test concurrent batches from a thread pool."""
+        chunks = [self.JDN[i::4] for i in range(4)]
+        with ThreadPoolExecutor(max_workers=4) as executor:
+            results = list(executor.map(jdn_to_ethiopic_batch, chunks))
+        for chunk, (ey, em, ed) in zip(chunks, results):
+            assert ethiopic_to_jdn_batch(ey, em, ed) == chunk
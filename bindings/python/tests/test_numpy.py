@@ -0,0 +1,143 @@
+"""
+Test cases for the NumPy ufuncs.
+"""
+
+import pytest
+
+np = pytest.importorskip("numpy")
+ednp = pytest.importorskip("ethiopian_date_converter.np")
+
+from ethiopian_date_converter import (
+    gregorian_to_ethiopic,
+    ethiopic_to_gregorian,
+    jdn_to_ethiopic,
+    jdn_to_gregorian,
+    is_ethiopic_holiday,
+    gregorian_to_jdn,
+    load_islamic_holidays,
+)
+
+JDN = np.arange(2400000, 2500000, 37)
+
+class TestUfuncs:
+    """Test the ufuncs against the scalar functions."""
+    
+    @pytest.mark.parametrize("dtype", [np.int32, np.int64])
+    def test_jdn_round_trips(self, dtype):
+        """Test JDN -> date -> JDN in both calendars."""
+        jdn = JDN.astype(dtype)
+        ey, em, ed = ednp.jdn_to_ethiopic(jdn)
+        gy, gm, gd = ednp.jdn_to_gregorian(jdn)
+        assert ey.dtype == dtype
+        assert (ednp.ethiopic_to_jdn(ey, em, ed) == jdn).all()
+        assert (ednp.gregorian_to_jdn(gy, gm, gd) == jdn).all()
+    
+    def test_matches_scalar_functions(self):
+        """Test against the scalar conversion functions."""
+        gy, gm, gd = ednp.jdn_to_gregorian(JDN)
+        ey, em, ed = ednp.gregorian_to_ethiopic(gy, gm, gd)
+        by, bm, bd = ednp.ethiopic_to_gregorian(ey, em, ed)
+        for i in range(0, len(JDN), 101):
+            jdn = int(JDN[i])
+            assert {"year": gy[i], "month": gm[i], "day": gd[i]} == jdn_to_gregorian(jdn)
+            assert {"year": ey[i], "month": em[i], "day": ed[i]} == jdn_to_ethiopic(jdn)
+            assert {"year": ey[i], "month": em[i], "day": ed[i]} == \
+                gregorian_to_ethiopic(int(gy[i]), int(gm[i]), int(gd[i]))
+            assert {"year": by[i], "month": bm[i], "day": bd[i]} == \
+                ethiopic_to_gregorian(int(ey[i]), int(em[i]), int(ed[i]))
+    
+    def test_broadcasting(self):
+        """Test scalar and array operands broadcasting together."""
+        months = np.arange(1, 13).reshape(3, 4)
+        ey, em, ed = ednp.gregorian_to_ethiopic(2025, months, 1)
+        assert ey.shape == (3, 4)
+        assert (ey[0, 0], em[0, 0], ed[0, 0]) == (2017, 4, 23)
+    
+    def test_out_in_place(self):
+        """Test out= with the input arrays as outputs."""
+        y, m, d = np.array([2024]), np.array([9]), np.array([11])
+        result = ednp.gregorian_to_ethiopic(y, m, d, out=(y, m, d))
+        assert result[0] is y
+        assert (y[0], m[0], d[0]) == (2017, 1, 1)
+    
+    def test_strided_input(self):
+        """Test non-contiguous input views."""
+        jdn = np.repeat(JDN, 2)[::2]
+        assert (ednp.jdn_to_ethiopic(jdn)[0] == ednp.jdn_to_ethiopic(JDN)[0]).all()
+    
+    def test_invalid_dates(self):
+        """Test that invalid dates convert to zeros."""
+        ey, em, ed = ednp.gregorian_to_ethiopic(np.array([2023]), np.array([2]), np.array([29]))
+        assert (ey[0], em[0], ed[0]) == (0, 0, 0)
+
+    def test_int64_fields_beyond_int32_are_invalid(self):
+        """Test that int64 date fields are not truncated to int32."""
+        years = np.array([2016, 2**32 + 2016], dtype=np.int64)
+        months = np.array([13, 13], dtype=np.int64)
+        days = np.array([5, 5], dtype=np.int64)
+        gy, gm, gd = ednp.ethiopic_to_gregorian(years, months, days)
+        assert (gy.tolist(), gm.tolist(), gd.tolist()) == ([2024, 0], [9, 0], [10, 0])
+        assert ednp.ethiopic_to_jdn(years, months, days)[1] == 0
+        dates = ednp.ethiopic_to_datetime64(years, months, days)
+        assert not np.isnat(dates[0]) and np.isnat(dates[1])
+
+    @pytest.mark.parametrize("dtype", [np.int32, np.int64])
+    def test_is_ethiopic_holiday(self, dtype):
+        """Test the holiday ufunc against the scalar lookup, movable feasts included."""
+        jdn = np.arange(2460000, 2461500).astype(dtype)
+        holidays = ednp.is_ethiopic_holiday(jdn)
+        assert holidays.dtype == np.bool_
+        assert holidays.tolist() == [is_ethiopic_holiday(int(day)) for day in jdn]
+    
+    def test_is_ethiopic_holiday_sees_islamic_holidays(self, tmp_path):
+        """Test that a loaded Islamic holiday table reaches the ufunc module's core."""
+        path = tmp_path / "islamic.txt"
+        path.write_text("2025-06-06 Eid al-Adha\n")
+        eid = gregorian_to_jdn(2025, 6, 6)
+        try:
+            load_islamic_holidays(path)
+            assert ednp.is_ethiopic_holiday(np.array([eid])).tolist() == [True]
+        finally:
+            path.write_text("")
+            load_islamic_holidays(path)
+        assert ednp.is_ethiopic_holiday(np.array([eid])).tolist() == [False]
+    
+    def test_float_input_rejected(self):
+        """Test that floating-point input is not silently truncated."""
+        with pytest.raises(TypeError):
+            ednp.jdn_to_ethiopic(np.array([2460000.5]))
+
+class TestDatetime64:
+    """Test datetime64[D] conversion."""
+    
+    def test_round_trip(self):
+        """Test datetime64[D] -> Ethiopian -> datetime64[D]."""
+        dates = np.arange("1900-01-01", "2100-01-01", 13, dtype="datetime64[D]")
+        ey, em, ed = ednp.datetime64_to_ethiopic(dates)
+        assert (ednp.ethiopic_to_datetime64(ey, em, ed) == dates).all()
+    
+    def test_matches_gregorian_path(self):
+        """Test against converting the same days through JDN."""
+        dates = np.arange("1960-01-01", "2040-01-01", 29, dtype="datetime64[D]")
+        jdn = dates.view(np.int64) + 2440588
+        for a, b in zip(ednp.datetime64_to_ethiopic(dates), ednp.jdn_to_ethiopic(jdn)):
+            assert (a == b).all()
+    
+    def test_epoch(self):
+        """Test 1970-01-01, day zero."""
+        ey, em, ed = ednp.datetime64_to_ethiopic(np.array(["1970-01-01"], dtype="datetime64[D]"))
+        assert (ey[0], em[0], ed[0]) == (1962, 4, 23)
+    
+    def test_other_units(self):
+        """Test that nanosecond timestamps floor to their day."""
+        stamps = np.array(["2024-09-11T23:59:59", "1969-12-31T12:00"], dtype="datetime64[ns]")
+        ey, em, ed = ednp.datetime64_to_ethiopic(stamps)
+        assert (ey[0], em[0], ed[0]) == (2017, 1, 1)
+        assert (ey[1], em[1], ed[1]) == (1962, 4, 22)
+    
+    def test_nat_and_invalid(self):
+        """Test NaT input and invalid Ethiopian dates."""
+        ey, em, ed = ednp.datetime64_to_ethiopic(np.array(["NaT"], dtype="datetime64[D]"))
+        assert (ey[0], em[0], ed[0]) == (0, 0, 0)
+        dates = ednp.ethiopic_to_datetime64(np.array([2016]), np.array([13]), np.array([6]))
+        assert np.isnat(dates[0])
@@ -0,0 +1,72 @@
+"""
+Test cases for the pandas .ethiopic accessor.
+"""
+
+import pytest
+
+pd = pytest.importorskip("pandas")
+pytest.importorskip("ethiopian_date_converter.np")
+
+import ethiopian_date_converter.pandas  # noqa: F401  (registers the accessor)
+from ethiopian_date_converter import EthiopicDate, gregorian_to_ethiopic
+
+class TestEthiopicAccessor:
+    """Test Series.ethiopic."""
+    
+    def test_fields(self):
+        """Test year, month and day against the scalar conversion."""
+        s = pd.Series(pd.date_range("2020-01-01", "2026-12-31", freq="13D"), name="date")
+        year, month, day = s.ethiopic.year, s.ethiopic.month, s.ethiopic.day
+        assert year.name == "date" and (year.index == s.index).all()
+        for i in range(0, len(s), 17):
+            t = s.iloc[i]
+            expected = gregorian_to_ethiopic(t.year, t.month, t.day)
+            assert (year.iloc[i], month.iloc[i], day.iloc[i]) == \
+                (expected["year"], expected["month"], expected["day"])
+    
+    def test_month_name_and_holidays(self):
+        """Test month names and fixed holidays."""
+        s = pd.Series(pd.to_datetime(["2024-09-11", "2025-01-07", "2025-01-08"]))
+        assert s.ethiopic.month_name().tolist() == ["Meskerem", "Tahsas", "Tahsas"]
+        assert s.ethiopic.month_name("am").iloc[0] == "መስከረም"
+        assert s.ethiopic.is_holiday.tolist() == [True, True, False]
+    
+    def test_movable_holidays(self):
+        """Test that movable feasts come from the core, as EthiopicDate.is_holiday() does."""
+        # 2025-04-18 is Good Friday (Ethiopian 2017-08-10), 2025-04-20 Easter
+        s = pd.Series(pd.to_datetime(["2025-04-18", "2025-04-19", "2025-04-20", None]))
+        assert s.ethiopic.is_holiday.tolist() == [True, False, True, False]
+        assert EthiopicDate(2017, 8, 10).is_holiday()
+    
+    def test_missing_values(self):
+        """Test that NaT gives NaN fields."""
+        s = pd.Series(pd.to_datetime(["2024-09-11", None]))
+        assert s.ethiopic.year.iloc[0] == 2017
+        assert pd.isna(s.ethiopic.year.iloc[1])
+        assert pd.isna(s.ethiopic.month_name().iloc[1])
+        assert pd.isna(s.ethiopic.to_gregorian().iloc[1])
+    
+    def test_ethiopic_date_objects(self):
+        """Test a Series of EthiopicDate objects."""
+        s = pd.Series([EthiopicDate(2017, 1, 1), EthiopicDate(2017, 4, 29)])
+        assert s.ethiopic.to_gregorian().tolist() == list(pd.to_datetime(["2024-09-11", "2025-01-07"]))
+        assert s.ethiopic.is_holiday.all()
+    
+    def test_timestamps_floor_to_day(self):
+        """Test that time of day and time zone do not change the day."""
+        s = pd.Series(pd.to_datetime(["2024-09-11 23:30"]).tz_localize("Africa/Addis_Ababa"))
+        assert s.ethiopic.day.iloc[0] == 1
+        assert s.ethiopic.to_gregorian().iloc[0] == pd.Timestamp("2024-09-11")
+    
+    def test_converts_once(self):
+        """Test that fields are cached on the accessor."""
+        s = pd.Series(pd.to_datetime(["2024-09-11"]))
+        s.ethiopic.year
+        fields = s.ethiopic._fields
+        s.ethiopic.month
+        assert s.ethiopic._fields is fields
+    
+    def test_rejects_other_dtypes(self):
+        """Test that non-date Series have no accessor."""
+        with pytest.raises(AttributeError):
+            pd.Series([1, 2, 3]).ethiopic
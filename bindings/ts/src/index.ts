@@ -5,7 +5,7 @@
  * with full type safety and modern development experience.
  */
 
-import { NativeBinding } from './types';
+import { NativeBinding, HolidayOccurrence, MonthGrid, CalendarType, CalendarMonth, CalendarDayInfo } from './types';
 import { EthiopicDate } from './lib/EthiopicDate';
 import { GregorianDate } from './lib/GregorianDate';
 import { MONTH_NAMES, DAY_NAMES, ETHIOPIAN_HOLIDAYS, ETHIOPIAN_SEASONS } from './lib/constants';
@@ -22,6 +22,19 @@ try {
 EthiopicDate.initBinding(binding);
 GregorianDate.initBinding(binding);
 
+// Recently requested month grids, oldest first: a Map keeps insertion order,
+// so a hit is moved to the end and the first key is the one to evict
+const MONTH_GRID_CACHE_SIZE = 32;
+const monthGridCache = new Map<string, MonthGrid>();
+
+function freezeGrid(grid: MonthGrid): MonthGrid {
+    for (const table of [grid.days, grid.jdns, grid.holidays] as ReadonlyArray<ReadonlyArray<unknown>>[]) {
+        table.forEach(row => Object.freeze(row));
+        Object.freeze(table);
+    }
+    return Object.freeze(grid);
+}
+
 /**
  * Calendar utilities for advanced operations
  */
@@ -29,106 +42,66 @@ export class CalendarUtils {
     /**
      * Generate calendar month view for Ethiopian calendar
      */
-    static generateEthiopicCalendar(year: number, month: number) {
-        const firstDay = new EthiopicDate(year, month, 1);
-        const firstDayOfWeek = firstDay.getDayOfWeek();
-        
-        // Get number of days in this month
-        let daysInMonth = 30;
-        if (month === 13) {
-            try {
-                new EthiopicDate(year, month, 6);
-                daysInMonth = 6; // Leap year
-            } catch (e) {
-                daysInMonth = 5; // Regular year
-            }
-        }
-        
-        const calendar: Array<Array<any | null>> = [];
-        let currentWeek: Array<any | null> = new Array(7).fill(null);
-        
-        // Fill in the days
-        for (let day = 1; day <= daysInMonth; day++) {
-            const date = new EthiopicDate(year, month, day);
-            const dayOfWeek = (day - 1 + firstDayOfWeek) % 7;
-            currentWeek[dayOfWeek] = {
-                date: date,
-                day: day,
-                isToday: date.isToday(),
-                isHoliday: date.isHoliday(),
-                holiday: date.getHoliday()
-            };
-            
-            if (dayOfWeek === 6 || day === daysInMonth) {
-                calendar.push([...currentWeek]);
-                currentWeek = new Array(7).fill(null);
-            }
-        }
-        
-        return {
-            year: year,
-            month: month,
-            monthName: firstDay.getMonthName(),
-            weeks: calendar,
-            daysInMonth: daysInMonth
-        };
+    static generateEthiopicCalendar(year: number, month: number): CalendarMonth {
+        return CalendarUtils.generateCalendar(DateConverter.monthGrid(year, month, 'ethiopic'),
+                                              day => new EthiopicDate(year, month, day));
     }
 
     /**
      * Generate calendar month view for Gregorian calendar
      */
-    static generateGregorianCalendar(year: number, month: number) {
-        const firstDay = new GregorianDate(year, month, 1);
-        const firstDayOfWeek = firstDay.getDayOfWeek();
-        const daysInMonth = firstDay.isLeapYear() && month === 2 ? 29 : 
-                           month === 2 ? 28 :
-                           [31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31][month - 1];
-        
-        const calendar: Array<Array<any | null>> = [];
-        let currentWeek: Array<any | null> = new Array(7).fill(null);
-        
-        // Fill in the days
-        for (let day = 1; day <= daysInMonth; day++) {
-            const date = new GregorianDate(year, month, day);
-            const dayOfWeek = (day - 1 + firstDayOfWeek) % 7;
-            currentWeek[dayOfWeek] = {
-                date: date,
-                day: day,
-                isToday: date.isToday()
-            };
-            
-            if (dayOfWeek === 6 || day === daysInMonth) {
-                calendar.push([...currentWeek]);
-                currentWeek = new Array(7).fill(null);
-            }
+    static generateGregorianCalendar(year: number, month: number): CalendarMonth {
+        return CalendarUtils.generateCalendar(DateConverter.monthGrid(year, month, 'gregorian'),
+                                              day => new GregorianDate(year, month, day));
+    }
+
+    /**
+     * Lay out a month view on the core's (cached) month grid: the month length,
+     * weekdays and holidays all come from the grid, and today is one JDN compare
+     */
+    private static generateCalendar(grid: MonthGrid,
+                                    createDate: (day: number) => EthiopicDate | GregorianDate): CalendarMonth {
+        const now = new Date();
+        const todayJdn = binding.gregorianToJDN(now.getFullYear(), now.getMonth() + 1, now.getDate());
+        const weeks: Array<Array<CalendarDayInfo | null>> = [];
+        const firstDay = createDate(1);
+
+        for (let week = 0; week < grid.weeks; week++) {
+            weeks.push(grid.days[week].map((day, weekday) => {
+                if (day === 0) {
+                    return null;
+                }
+                const date = day === 1 ? firstDay : createDate(day);
+                const info: CalendarDayInfo = {
+                    date: date,
+                    day: day,
+                    isToday: grid.jdns[week][weekday] === todayJdn
+                };
+                if (grid.calendar === 'ethiopic') {
+                    const holiday = grid.holidays[week][weekday];
+                    info.isHoliday = holiday !== null;
+                    info.holiday = holiday ?? undefined;
+                }
+                return info;
+            }));
         }
-        
+
         return {
-            year: year,
-            month: month,
+            year: grid.year,
+            month: grid.month,
             monthName: firstDay.getMonthName(),
-            weeks: calendar,
-            daysInMonth: daysInMonth
+            weeks: weeks,
+            daysInMonth: grid.daysInMonth
         };
     }
 
     /**
-     * Get business days between two dates (excluding weekends)
+     * Get business days between two dates (excluding weekends, and the
+     * Ethiopian holidays when excludeHolidays is true); constant time for any range
      */
-    static getBusinessDaysBetween(startDate: EthiopicDate | GregorianDate, endDate: EthiopicDate | GregorianDate): number {
-        let count = 0;
-        let current = startDate.clone();
-        
-        while (current.isBefore(endDate) || current.isSame(endDate)) {
-            const dayOfWeek = current.getDayOfWeek();
-            // Monday = 0, ..., Friday = 4, Saturday = 5, Sunday = 6
-            if (dayOfWeek <= 4) { // Monday to Friday
-                count++;
-            }
-            current = current.addDays(1);
-        }
-        
-        return count;
+    static getBusinessDaysBetween(startDate: EthiopicDate | GregorianDate, endDate: EthiopicDate | GregorianDate,
+                                  excludeHolidays: boolean = false): number {
+        return binding.businessDaysBetween(startDate.getJDN(), endDate.getJDN(), excludeHolidays);
     }
 }
 
@@ -202,6 +175,92 @@ export class DateConverter {
         return binding.getDayOfWeek(jdn);
     }
 
+    /**
+     * Count Monday-Friday days in [startJdn, endJdn], minus the Ethiopian
+     * holidays unless excludeHolidays is false
+     */
+    static businessDaysBetween(startJdn: number, endJdn: number, excludeHolidays: boolean = true): number {
+        return binding.businessDaysBetween(startJdn, endJdn, excludeHolidays);
+    }
+
+    /**
+     * Check if a JDN is an Ethiopian holiday: one bit test in the core's
+     * per-year holiday bitmap
+     */
+    static isEthiopicHoliday(jdn: number): boolean {
+        return binding.isEthiopicHoliday(jdn);
+    }
+
+    /**
+     * Name of the holiday on a JDN, or null
+     */
+    static ethiopicHolidayName(jdn: number): string | null {
+        return binding.ethiopicHolidayName(jdn);
+    }
+
+    /**
+     * First holiday on or after a JDN, found with a binary search in the core's
+     * sorted holiday index
+     */
+    static nextEthiopicHoliday(jdn: number): HolidayOccurrence {
+        return binding.nextEthiopicHoliday(jdn);
+    }
+
+    /**
+     * First holiday after a JDN
+     */
+    static nextEthiopicHolidayAfter(jdn: number): HolidayOccurrence {
+        return binding.nextEthiopicHolidayAfter(jdn);
+    }
+
+    /**
+     * Holidays of a closed JDN range in date order; empty when endJdn is before
+     * startJdn
+     */
+    static ethiopicHolidaysInRange(startJdn: number, endJdn: number): HolidayOccurrence[] {
+        return binding.ethiopicHolidaysInRange(startJdn, endJdn);
+    }
+
+    /**
+     * JDN of Ethiopian Orthodox Easter (Fasika) in an Ethiopian year
+     */
+    static ethiopicEaster(year: number): number {
+        return binding.ethiopicEaster(year);
+    }
+
+    /**
+     * Replace the Islamic holiday table with the "YYYY-MM-DD Name" lines of a
+     * text file; returns the number of holidays loaded
+     */
+    static loadIslamicHolidays(path: string): number {
+        const count = binding.loadIslamicHolidays(path);
+        monthGridCache.clear();
+        return count;
+    }
+
+    /**
+     * 6x7 grid of a month filled by the core, weeks starting on Monday; days
+     * are 0 outside the month. The last few months are kept in an LRU cache
+     * and returned frozen, so callers share them.
+     */
+    static monthGrid(year: number, month: number, calendar: CalendarType = 'ethiopic'): MonthGrid {
+        if (calendar !== 'ethiopic' && calendar !== 'gregorian') {
+            throw new RangeError("calendar must be 'ethiopic' or 'gregorian'");
+        }
+        const key = `${calendar}:${year}:${month}`;
+        let grid = monthGridCache.get(key);
+        if (grid !== undefined) {
+            monthGridCache.delete(key);
+        } else {
+            grid = freezeGrid(binding.monthGrid(year, month, calendar === 'gregorian'));
+            if (monthGridCache.size >= MONTH_GRID_CACHE_SIZE) {
+                monthGridCache.delete(monthGridCache.keys().next().value as string);
+            }
+        }
+        monthGridCache.set(key, grid);
+        return grid;
+    }
+
     /**
      * Get epoch constants
      */
@@ -256,6 +315,43 @@ export function getDayOfWeek(jdn: number): number {
     return DateConverter.getDayOfWeek(jdn);
 }
 
+export function businessDaysBetween(startJdn: number, endJdn: number, excludeHolidays: boolean = true): number {
+    return DateConverter.businessDaysBetween(startJdn, endJdn, excludeHolidays);
+}
+
+// Holiday lookups
+export function isEthiopicHoliday(jdn: number): boolean {
+    return DateConverter.isEthiopicHoliday(jdn);
+}
+
+export function ethiopicHolidayName(jdn: number): string | null {
+    return DateConverter.ethiopicHolidayName(jdn);
+}
+
+export function nextEthiopicHoliday(jdn: number): HolidayOccurrence {
+    return DateConverter.nextEthiopicHoliday(jdn);
+}
+
+export function nextEthiopicHolidayAfter(jdn: number): HolidayOccurrence {
+    return DateConverter.nextEthiopicHolidayAfter(jdn);
+}
+
+export function ethiopicHolidaysInRange(startJdn: number, endJdn: number): HolidayOccurrence[] {
+    return DateConverter.ethiopicHolidaysInRange(startJdn, endJdn);
+}
+
+export function ethiopicEaster(year: number): number {
+    return DateConverter.ethiopicEaster(year);
+}
+
+export function loadIslamicHolidays(path: string): number {
+    return DateConverter.loadIslamicHolidays(path);
+}
+
+export function monthGrid(year: number, month: number, calendar: CalendarType = 'ethiopic'): MonthGrid {
+    return DateConverter.monthGrid(year, month, calendar);
+}
+
 // Main exports
 export {
     EthiopicDate,
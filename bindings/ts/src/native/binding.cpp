@@ -1,7 +1,8 @@
 /* Copyright (c) 2025 Abiy */
 
 #include <napi.h>
-#include "core/ethiopic_calendar.h"
+#include <string>
+#include "ethiopic_calendar.h"
 
 
 Napi::Object CreateDateObject(Napi::Env env, const date_t& date) {
@@ -212,6 +213,216 @@ Napi::Value GetDayOfWeek(const Napi::CallbackInfo& info) {
     return Napi::Number::New(env, dayOfWeek);
 }
 
+// Wrapper for business_days_between
+Napi::Value BusinessDaysBetween(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Expected at least 2 arguments: startJdn, endJdn").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t startJdn = static_cast<int64_t>(info[0].As<Napi::Number>().DoubleValue());
+    int64_t endJdn = static_cast<int64_t>(info[1].As<Napi::Number>().DoubleValue());
+    bool excludeHolidays = info.Length() < 3 || info[2].IsUndefined() || info[2].ToBoolean().Value();
+    
+    return Napi::Number::New(env, static_cast<double>(business_days_between(startJdn, endJdn, excludeHolidays)));
+}
+
+// Holiday lookups, backed by the core's per-year holiday bitmaps
+
+static Napi::Value HolidayNameOrNull(Napi::Env env, int32_t id) {
+    if (id == ETHIOPIC_HOLIDAY_NONE) {
+        return env.Null();
+    }
+    return Napi::String::New(env, ethiopic_holiday_name(id));
+}
+
+// Wrapper for is_ethiopic_holiday
+Napi::Value IsEthiopicHoliday(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Expected 1 argument: jdn").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t jdn = static_cast<int64_t>(info[0].As<Napi::Number>().DoubleValue());
+    return Napi::Boolean::New(env, is_ethiopic_holiday(jdn));
+}
+
+// Wrapper for ethiopic_holiday_id / ethiopic_holiday_name: the name or null
+Napi::Value EthiopicHolidayName(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Expected 1 argument: jdn").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t jdn = static_cast<int64_t>(info[0].As<Napi::Number>().DoubleValue());
+    return HolidayNameOrNull(env, ethiopic_holiday_id(jdn));
+}
+
+// Wrapper for ethiopic_next_holiday: {jdn, name} of the first holiday on or after jdn
+Napi::Value NextEthiopicHoliday(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Expected 1 argument: jdn").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t jdn = static_cast<int64_t>(info[0].As<Napi::Number>().DoubleValue());
+    int32_t id = ETHIOPIC_HOLIDAY_NONE;
+    int64_t holiday = ethiopic_next_holiday(jdn, &id);
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("jdn", Napi::Number::New(env, static_cast<double>(holiday)));
+    result.Set("name", HolidayNameOrNull(env, id));
+    return result;
+}
+
+// Wrapper for ethiopic_next_holiday_after: {jdn, name} of the first holiday after jdn
+Napi::Value NextEthiopicHolidayAfter(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Expected 1 argument: jdn").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t jdn = static_cast<int64_t>(info[0].As<Napi::Number>().DoubleValue());
+    int32_t id = ETHIOPIC_HOLIDAY_NONE;
+    int64_t holiday = ethiopic_next_holiday_after(jdn, &id);
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("jdn", Napi::Number::New(env, static_cast<double>(holiday)));
+    result.Set("name", HolidayNameOrNull(env, id));
+    return result;
+}
+
+// Wrapper for ethiopic_holidays_in_range: [{jdn, name}, ...] of the holidays of a closed JDN range
+Napi::Value EthiopicHolidaysInRange(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Expected 2 arguments: startJdn, endJdn").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int64_t start_jdn = static_cast<int64_t>(info[0].As<Napi::Number>().DoubleValue());
+    int64_t end_jdn = static_cast<int64_t>(info[1].As<Napi::Number>().DoubleValue());
+    Napi::Array result = Napi::Array::New(env);
+    uint32_t length = 0;
+    ethiopic_dated_holiday_t chunk[64];
+    size_t written;
+    
+    // A full chunk may be followed by more holidays, from the day after its last one
+    do {
+        written = ethiopic_holidays_in_range(start_jdn, end_jdn, chunk, 64);
+        for (size_t i = 0; i < written; i++) {
+            Napi::Object holiday = Napi::Object::New(env);
+            holiday.Set("jdn", Napi::Number::New(env, static_cast<double>(chunk[i].jdn)));
+            holiday.Set("name", HolidayNameOrNull(env, chunk[i].id));
+            result.Set(length++, holiday);
+        }
+        if (written > 0) {
+            start_jdn = chunk[written - 1].jdn + 1;
+        }
+    } while (written == 64);
+    return result;
+}
+
+// Wrapper for ethiopic_easter
+Napi::Value EthiopicEaster(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Expected 1 argument: year").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int32_t year = info[0].As<Napi::Number>().Int32Value();
+    return Napi::Number::New(env, static_cast<double>(ethiopic_easter(year)));
+}
+
+// Wrapper for ethiopic_load_islamic_holidays: the number of holidays loaded
+Napi::Value LoadIslamicHolidays(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "Expected 1 argument: path").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    std::string path = info[0].As<Napi::String>().Utf8Value();
+    int32_t result = ethiopic_load_islamic_holidays(path.c_str());
+    
+    if (result == ETHIOPIC_HOLIDAY_ERROR_IO) {
+        Napi::Error::New(env, "Cannot read Islamic holiday file: " + path).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (result < 0) {
+        Napi::Error::New(env, "Invalid Islamic holiday file: " + path).ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    return Napi::Number::New(env, result);
+}
+
+// Copies one 6x7 table of an ethiopic_month_grid_t into rows of JavaScript values
+template <typename Cell, typename Convert>
+static Napi::Array GridRows(Napi::Env env, const Cell (&cells)[ETHIOPIC_GRID_WEEKS][7], Convert convert) {
+    Napi::Array rows = Napi::Array::New(env, ETHIOPIC_GRID_WEEKS);
+    for (uint32_t week = 0; week < ETHIOPIC_GRID_WEEKS; week++) {
+        Napi::Array row = Napi::Array::New(env, 7);
+        for (uint32_t weekday = 0; weekday < 7; weekday++) {
+            row.Set(weekday, convert(cells[week][weekday]));
+        }
+        rows.Set(week, row);
+    }
+    return rows;
+}
+
+// Wrapper for ethiopic_month_grid: the 6x7 grid of a month, weeks starting on Monday
+Napi::Value MonthGrid(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: year, month, gregorian").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    int32_t year = info[0].As<Napi::Number>().Int32Value();
+    int32_t month = info[1].As<Napi::Number>().Int32Value();
+    bool gregorian = info[2].ToBoolean().Value();
+    ethiopic_month_grid_t grid;
+    
+    if (!ethiopic_month_grid(gregorian ? ETHIOPIC_GRID_GREGORIAN : ETHIOPIC_GRID_ETHIOPIC, year, month, &grid)) {
+        Napi::RangeError::New(env, gregorian ? "Invalid Gregorian month" : "Invalid Ethiopian month")
+            .ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("year", Napi::Number::New(env, year));
+    result.Set("month", Napi::Number::New(env, month));
+    result.Set("calendar", Napi::String::New(env, gregorian ? "gregorian" : "ethiopic"));
+    result.Set("daysInMonth", Napi::Number::New(env, grid.days_in_month));
+    result.Set("firstWeekday", Napi::Number::New(env, grid.first_weekday));
+    result.Set("weeks", Napi::Number::New(env, grid.weeks));
+    result.Set("days", GridRows(env, grid.day, [env](uint8_t day) {
+        return Napi::Number::New(env, day);
+    }));
+    result.Set("jdns", GridRows(env, grid.jdn, [env](int64_t jdn) {
+        return Napi::Number::New(env, static_cast<double>(jdn));
+    }));
+    result.Set("holidays", GridRows(env, grid.holiday, [env](int8_t id) {
+        return HolidayNameOrNull(env, id);
+    }));
+    return result;
+}
+
 
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("ethiopicToGregorian", Napi::Function::New(env, EthiopicToGregorian));
@@ -226,6 +437,15 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("jdnToEthiopic", Napi::Function::New(env, JDNToEthiopic));
     exports.Set("jdnToGregorian", Napi::Function::New(env, JDNToGregorian));
     exports.Set("getDayOfWeek", Napi::Function::New(env, GetDayOfWeek));
+    exports.Set("businessDaysBetween", Napi::Function::New(env, BusinessDaysBetween));
+    exports.Set("isEthiopicHoliday", Napi::Function::New(env, IsEthiopicHoliday));
+    exports.Set("ethiopicHolidayName", Napi::Function::New(env, EthiopicHolidayName));
+    exports.Set("nextEthiopicHoliday", Napi::Function::New(env, NextEthiopicHoliday));
+    exports.Set("nextEthiopicHolidayAfter", Napi::Function::New(env, NextEthiopicHolidayAfter));
+    exports.Set("ethiopicHolidaysInRange", Napi::Function::New(env, EthiopicHolidaysInRange));
+    exports.Set("ethiopicEaster", Napi::Function::New(env, EthiopicEaster));
+    exports.Set("loadIslamicHolidays", Napi::Function::New(env, LoadIslamicHolidays));
+    exports.Set("monthGrid", Napi::Function::New(env, MonthGrid));
 
     exports.Set("JD_EPOCH_OFFSET_AMETE_ALEM", 
                 Napi::Number::New(env, JD_EPOCH_OFFSET_AMETE_ALEM));
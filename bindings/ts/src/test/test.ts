@@ -200,6 +200,23 @@ function runTests(): void {
         return calendar.year === 2017 && calendar.month === 1 && calendar.monthName === 'Meskerem';
     });
 
+    runner.test('Generated calendars follow the month grid', () => {
+        const meskerem = CalendarUtils.generateEthiopicCalendar(2017, 1);
+        const pagume = CalendarUtils.generateEthiopicCalendar(2015, 13);
+        const newYear = meskerem.weeks[0][2];
+        return meskerem.weeks.length === 5 && meskerem.weeks[0][1] === null &&
+               newYear !== null && newYear.day === 1 && newYear.holiday === 'Ethiopian New Year' &&
+               pagume.daysInMonth === 6 &&
+               CalendarUtils.generateGregorianCalendar(2021, 2).weeks.length === 4;
+    });
+
+    runner.test('Month grids are cached', () => {
+        const grid = DateConverter.monthGrid(2017, 1);
+        return grid === DateConverter.monthGrid(2017, 1) && Object.isFrozen(grid) &&
+               grid.firstWeekday === 2 && grid.holidays[2][4] === 'Finding of the True Cross' &&
+               grid.jdns[0][2] === DateConverter.ethiopicToJDN(2017, 1, 1);
+    });
+
     runner.test('Business days calculation', () => {
         const start = new GregorianDate(2024, 9, 9); // Monday
         const end = new GregorianDate(2024, 9, 13);   // Friday
@@ -207,6 +224,41 @@ function runTests(): void {
         return businessDays === 5;
     });
 
+    runner.test('Business days excluding holidays', () => {
+        // 11 September 2024 is Ethiopian New Year
+        const start = new GregorianDate(2024, 9, 9);
+        const end = new GregorianDate(2024, 9, 13);
+        return CalendarUtils.getBusinessDaysBetween(start, end, true) === 4 &&
+               DateConverter.businessDaysBetween(end.getJDN(), start.getJDN()) === 4;
+    });
+
+    runner.test('Native holiday lookups', () => {
+        const genna = DateConverter.ethiopicToJDN(2017, 4, 29);
+        const next = DateConverter.nextEthiopicHoliday(genna + 1);
+        return DateConverter.isEthiopicHoliday(genna) && !DateConverter.isEthiopicHoliday(genna + 1) &&
+               DateConverter.ethiopicHolidayName(genna) === 'Ethiopian Christmas' &&
+               DateConverter.ethiopicHolidayName(genna + 1) === null &&
+               next.jdn === genna + 12 && next.name === 'Epiphany (Timkat)';
+    });
+
+    runner.test('Movable feasts', () => {
+        // Fasika 2017 is 20 April 2025
+        const easter = DateConverter.ethiopicEaster(2017);
+        return easter === DateConverter.gregorianToJDN(2025, 4, 20) &&
+               DateConverter.ethiopicHolidayName(easter - 2) === 'Good Friday' &&
+               DateConverter.nextEthiopicHoliday(easter - 6).name === 'Good Friday';
+    });
+
+    runner.test('Holiday range queries', () => {
+        const genna = DateConverter.ethiopicToJDN(2017, 4, 29);
+        const holidays = DateConverter.ethiopicHolidaysInRange(DateConverter.ethiopicToJDN(2017, 1, 1),
+                                                               DateConverter.ethiopicToJDN(2018, 1, 1) - 1);
+        return holidays.length === 8 && holidays[2].jdn === genna &&
+               holidays.every((holiday, i) => i === 0 ||
+                   DateConverter.nextEthiopicHolidayAfter(holidays[i - 1].jdn).jdn === holiday.jdn) &&
+               DateConverter.ethiopicHolidaysInRange(genna + 1, genna + 11).length === 0;
+    });
+
     // Test Current Dates
     console.log('\n--- Current Date Tests ---');
 
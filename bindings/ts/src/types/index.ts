@@ -40,6 +40,12 @@ export interface Holiday {
     nameAm: string;
 }
 
+// A holiday and its JDN, as returned by nextEthiopicHoliday and ethiopicHolidaysInRange
+export interface HolidayOccurrence {
+    jdn: number;
+    name: string;
+}
+
 export interface EthiopianHolidays {
     fixed: Holiday[];
     variable: Array<{ name: string; nameAm: string; }>;
@@ -60,6 +66,22 @@ export interface CalendarDayInfo {
     holiday?: string;
 }
 
+export type CalendarType = 'ethiopic' | 'gregorian';
+
+// A month laid out on six Monday-first weeks, as returned by monthGrid; days
+// are 0 and holidays null outside the month, and weeks is the number of rows used
+export interface MonthGrid {
+    readonly year: number;
+    readonly month: number;
+    readonly calendar: CalendarType;
+    readonly daysInMonth: number;
+    readonly firstWeekday: number;
+    readonly weeks: number;
+    readonly days: ReadonlyArray<ReadonlyArray<number>>;
+    readonly jdns: ReadonlyArray<ReadonlyArray<number>>;
+    readonly holidays: ReadonlyArray<ReadonlyArray<string | null>>;
+}
+
 export interface CalendarMonth {
     year: number;
     month: number;
@@ -97,6 +119,15 @@ export interface NativeBinding {
     jdnToEthiopic(jdn: number, era?: number | null): DateObject;
     jdnToGregorian(jdn: number): DateObject;
     getDayOfWeek(jdn: number): number;
+    businessDaysBetween(startJdn: number, endJdn: number, excludeHolidays?: boolean): number;
+    isEthiopicHoliday(jdn: number): boolean;
+    ethiopicHolidayName(jdn: number): string | null;
+    nextEthiopicHoliday(jdn: number): HolidayOccurrence;
+    nextEthiopicHolidayAfter(jdn: number): HolidayOccurrence;
+    ethiopicHolidaysInRange(startJdn: number, endJdn: number): HolidayOccurrence[];
+    ethiopicEaster(year: number): number;
+    loadIslamicHolidays(path: string): number;
+    monthGrid(year: number, month: number, gregorian: boolean): MonthGrid;
     
     readonly JD_EPOCH_OFFSET_AMETE_ALEM: number;
     readonly JD_EPOCH_OFFSET_AMETE_MIHRET: number;
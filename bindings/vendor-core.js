@@ -0,0 +1,35 @@
+#!/usr/bin/env node
+
+/**
+ * Copies the shared C core into a binding package before `npm pack`.
+ *
+ * Inside the repository the bindings compile ../../core directly; a published
+ * package has no such sibling, so it ships its own copy under core/.
+ * Usage: node ../vendor-core.js [package directory]
+ */
+
+const fs = require('fs');
+const path = require('path');
+
+const coreDir = path.join(__dirname, '..', 'core');
+const packageDir = path.resolve(process.argv[2] || process.cwd());
+const targetDir = path.join(packageDir, 'core');
+
+const flags = JSON.parse(fs.readFileSync(path.join(coreDir, 'build-flags.json'), 'utf8'));
+const files = ['build-flags.json'];
+for (const dir of flags.include_dirs) {
+    for (const name of fs.readdirSync(path.join(coreDir, dir))) {
+        if (/\.(c|h)$/.test(name)) {
+            files.push(path.join(dir, name));
+        }
+    }
+}
+
+fs.rmSync(targetDir, { recursive: true, force: true });
+for (const file of files) {
+    const target = path.join(targetDir, file);
+    fs.mkdirSync(path.dirname(target), { recursive: true });
+    fs.copyFileSync(path.join(coreDir, file), target);
+}
+
+console.log(`Vendored ${files.length} core files into ${targetDir}`);
@@ -0,0 +1,511 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "../src/ethiopic_calendar.h"
+
+
+/*
+ * Micro-benchmarks for every function in ethiopic_calendar.h
+ *
+ * Each benchmark converts one buffer of BENCH_DAYS inputs per pass and is run
+ * on three input patterns (sequential days, random days over 4713 BC - AD 9999,
+ * random days clustered in 1900-2100) with one thread and with every online
+ * CPU. Flags follow Google Benchmark:
+ *
+ *   --benchmark_filter=<substring>    run matching benchmarks only
+ *   --benchmark_min_time=<seconds>    minimum time per benchmark (default 0.1)
+ *   --benchmark_format=console|json   output format on stdout
+ *   --benchmark_out=<file>            also write JSON results to <file>
+ *   --threads=<n>                     multi-threaded runs use n threads
+ *   --simd=scalar|avx2|avx512         cap the vector kernel level
+ */
+
+#define BENCH_DAYS      (1 << 14)
+
+static const int64_t era = JD_EPOCH_OFFSET_AMETE_MIHRET;
+
+// Read-only inputs shared by all threads
+typedef struct {
+    int64_t jdn[BENCH_DAYS];
+    date_t gregorian[BENCH_DAYS];
+    date_t ethiopic[BENCH_DAYS];
+    int32_t greg_years[BENCH_DAYS], greg_months[BENCH_DAYS], greg_days[BENCH_DAYS];
+    int32_t eth_years[BENCH_DAYS], eth_months[BENCH_DAYS], eth_days[BENCH_DAYS];
+} bench_input_t;
+
+// Per-thread outputs for the batch and SoA paths
+typedef struct {
+    date_t dates[BENCH_DAYS];
+    int64_t jdn[BENCH_DAYS];
+    int32_t years[BENCH_DAYS], months[BENCH_DAYS], days[BENCH_DAYS];
+} bench_output_t;
+
+typedef int64_t (*bench_loop_t)(const bench_input_t* in, bench_output_t* out);
+
+typedef struct {
+    const char* name;
+    bench_loop_t loop;
+} bench_case_t;
+
+/*
+ * Loop bodies. Each loop calls the function directly so the compiler can
+ * inline it as it would at a real call site; the returned checksum keeps the
+ * results alive.
+ */
+#define BENCH_JDN_TO_DATE(fn, call)                                                 \
+    static int64_t bench_##fn(const bench_input_t* in, bench_output_t* out) {       \
+        int64_t acc = 0;                                                            \
+        (void)out;                                                                  \
+        for (int i = 0; i < BENCH_DAYS; i++) {                                      \
+            int64_t jdn = in->jdn[i];                                               \
+            date_t d = call;                                                        \
+            acc += d.year + d.month + d.day;                                        \
+        }                                                                           \
+        return acc;                                                                 \
+    }
+
+#define BENCH_DATE_TO_SCALAR(fn, dates, call)                                       \
+    static int64_t bench_##fn(const bench_input_t* in, bench_output_t* out) {       \
+        int64_t acc = 0;                                                            \
+        (void)out;                                                                  \
+        for (int i = 0; i < BENCH_DAYS; i++) {                                      \
+            date_t d = in->dates[i];                                                \
+            acc += (int64_t)(call);                                                 \
+        }                                                                           \
+        return acc;                                                                 \
+    }
+
+#define BENCH_JDN_TO_SCALAR(fn, call)                                               \
+    static int64_t bench_##fn(const bench_input_t* in, bench_output_t* out) {       \
+        int64_t acc = 0;                                                            \
+        (void)out;                                                                  \
+        for (int i = 0; i < BENCH_DAYS; i++) {                                      \
+            int64_t jdn = in->jdn[i];                                               \
+            acc += (int64_t)(call);                                                 \
+        }                                                                           \
+        return acc;                                                                 \
+    }
+
+#define BENCH_DATE_TO_DATE(fn, dates, call)                                         \
+    static int64_t bench_##fn(const bench_input_t* in, bench_output_t* out) {       \
+        int64_t acc = 0;                                                            \
+        (void)out;                                                                  \
+        for (int i = 0; i < BENCH_DAYS; i++) {                                      \
+            date_t d = in->dates[i];                                                \
+            date_t r = call;                                                        \
+            acc += r.year + r.month + r.day;                                        \
+        }                                                                           \
+        return acc;                                                                 \
+    }
+
+#define BENCH_BUFFER(fn, call, result)                                              \
+    static int64_t bench_##fn(const bench_input_t* in, bench_output_t* out) {       \
+        call;                                                                       \
+        return result;                                                              \
+    }
+
+BENCH_DATE_TO_SCALAR(is_gregorian_leap, gregorian, is_gregorian_leap(d.year))
+BENCH_DATE_TO_SCALAR(is_valid_gregorian_date, gregorian, is_valid_gregorian_date(d.year, d.month, d.day))
+BENCH_DATE_TO_SCALAR(is_valid_ethiopic_date, ethiopic, is_valid_ethiopic_date(d.year, d.month, d.day))
+BENCH_DATE_TO_SCALAR(gregorian_to_jdn, gregorian, gregorian_to_jdn(d.year, d.month, d.day))
+BENCH_DATE_TO_SCALAR(gregorian_to_jdn_table, gregorian, gregorian_to_jdn_table(d.year, d.month, d.day))
+BENCH_DATE_TO_SCALAR(ethiopic_to_jdn, ethiopic, ethiopic_to_jdn(d.year, d.month, d.day, era))
+BENCH_DATE_TO_SCALAR(ethiopic_to_jdn_fast, ethiopic, ethiopic_to_jdn_fast(d.year, d.month, d.day, era))
+BENCH_DATE_TO_SCALAR(ethiopic_to_jdn_table, ethiopic, ethiopic_to_jdn_table(d.year, d.month, d.day, era))
+BENCH_JDN_TO_DATE(jdn_to_gregorian, jdn_to_gregorian(jdn))
+BENCH_JDN_TO_DATE(jdn_to_gregorian_fast, jdn_to_gregorian_fast(jdn))
+BENCH_JDN_TO_DATE(jdn_to_gregorian_table, jdn_to_gregorian_table(jdn))
+BENCH_JDN_TO_DATE(jdn_to_ethiopic, jdn_to_ethiopic(jdn, era))
+BENCH_JDN_TO_DATE(jdn_to_ethiopic_fast, jdn_to_ethiopic_fast(jdn, era))
+BENCH_JDN_TO_DATE(jdn_to_ethiopic_table, jdn_to_ethiopic_table(jdn, era))
+BENCH_DATE_TO_DATE(ethiopic_to_gregorian, ethiopic, ethiopic_to_gregorian(d.year, d.month, d.day, era))
+BENCH_DATE_TO_DATE(gregorian_to_ethiopic, gregorian, gregorian_to_ethiopic(d.year, d.month, d.day))
+BENCH_JDN_TO_SCALAR(guess_era, guess_era(jdn))
+// A ten-year range from each input day
+BENCH_JDN_TO_SCALAR(business_days_between, business_days_between(jdn, jdn + 3652, true))
+BENCH_JDN_TO_SCALAR(is_ethiopic_holiday, is_ethiopic_holiday(jdn))
+BENCH_JDN_TO_SCALAR(ethiopic_next_holiday, ethiopic_next_holiday(jdn, NULL))
+
+// The holidays of a month-long range from each input day
+static size_t holidays_in_month_from(int64_t jdn) {
+    ethiopic_dated_holiday_t holidays[8];
+    size_t count = ethiopic_holidays_in_range(jdn, jdn + 29, holidays, 8);
+    return count > 0 ? count + (size_t)holidays[0].id : 0;
+}
+
+BENCH_JDN_TO_SCALAR(ethiopic_holidays_in_range, holidays_in_month_from(jdn))
+
+// The grid of the Ethiopian month holding each input day
+static int64_t month_grid_of(int64_t jdn) {
+    ethiopic_month_grid_t grid;
+    date_t date = jdn_to_ethiopic_fast(jdn, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    ethiopic_month_grid(ETHIOPIC_GRID_ETHIOPIC, date.year, date.month, &grid);
+    return grid.jdn[0][0] + grid.holiday[0][0];
+}
+
+BENCH_JDN_TO_SCALAR(ethiopic_month_grid, month_grid_of(jdn))
+
+BENCH_BUFFER(gregorian_to_ethiopic_batch,
+             gregorian_to_ethiopic_batch(in->gregorian, out->dates, BENCH_DAYS), out->dates[0].day)
+BENCH_BUFFER(ethiopic_to_gregorian_batch,
+             ethiopic_to_gregorian_batch(in->ethiopic, out->dates, BENCH_DAYS, era), out->dates[0].day)
+BENCH_BUFFER(gregorian_to_jdn_batch,
+             gregorian_to_jdn_batch(in->gregorian, out->jdn, BENCH_DAYS), out->jdn[0])
+BENCH_BUFFER(ethiopic_to_jdn_batch,
+             ethiopic_to_jdn_batch(in->ethiopic, out->jdn, BENCH_DAYS, era), out->jdn[0])
+BENCH_BUFFER(jdn_to_gregorian_batch,
+             jdn_to_gregorian_batch(in->jdn, out->dates, BENCH_DAYS), out->dates[0].day)
+BENCH_BUFFER(jdn_to_ethiopic_batch,
+             jdn_to_ethiopic_batch(in->jdn, out->dates, BENCH_DAYS, era), out->dates[0].day)
+BENCH_BUFFER(gregorian_to_jdn_soa,
+             gregorian_to_jdn_soa(in->greg_years, in->greg_months, in->greg_days, out->jdn, BENCH_DAYS),
+             out->jdn[0])
+BENCH_BUFFER(ethiopic_to_jdn_soa,
+             ethiopic_to_jdn_soa(in->eth_years, in->eth_months, in->eth_days, out->jdn, BENCH_DAYS, era),
+             out->jdn[0])
+BENCH_BUFFER(jdn_to_gregorian_soa,
+             jdn_to_gregorian_soa(in->jdn, out->years, out->months, out->days, BENCH_DAYS), out->days[0])
+BENCH_BUFFER(jdn_to_ethiopic_soa,
+             jdn_to_ethiopic_soa(in->jdn, out->years, out->months, out->days, BENCH_DAYS, era), out->days[0])
+
+#define BENCH_CASE(fn) {#fn, bench_##fn}
+
+static const bench_case_t bench_cases[] = {
+    BENCH_CASE(is_gregorian_leap),
+    BENCH_CASE(is_valid_gregorian_date),
+    BENCH_CASE(is_valid_ethiopic_date),
+    BENCH_CASE(gregorian_to_jdn),
+    BENCH_CASE(gregorian_to_jdn_table),
+    BENCH_CASE(ethiopic_to_jdn),
+    BENCH_CASE(ethiopic_to_jdn_fast),
+    BENCH_CASE(ethiopic_to_jdn_table),
+    BENCH_CASE(jdn_to_gregorian),
+    BENCH_CASE(jdn_to_gregorian_fast),
+    BENCH_CASE(jdn_to_gregorian_table),
+    BENCH_CASE(jdn_to_ethiopic),
+    BENCH_CASE(jdn_to_ethiopic_fast),
+    BENCH_CASE(jdn_to_ethiopic_table),
+    BENCH_CASE(ethiopic_to_gregorian),
+    BENCH_CASE(gregorian_to_ethiopic),
+    BENCH_CASE(guess_era),
+    BENCH_CASE(business_days_between),
+    BENCH_CASE(is_ethiopic_holiday),
+    BENCH_CASE(ethiopic_next_holiday),
+    BENCH_CASE(ethiopic_holidays_in_range),
+    BENCH_CASE(ethiopic_month_grid),
+    BENCH_CASE(gregorian_to_ethiopic_batch),
+    BENCH_CASE(ethiopic_to_gregorian_batch),
+    BENCH_CASE(gregorian_to_jdn_batch),
+    BENCH_CASE(ethiopic_to_jdn_batch),
+    BENCH_CASE(jdn_to_gregorian_batch),
+    BENCH_CASE(jdn_to_ethiopic_batch),
+    BENCH_CASE(gregorian_to_jdn_soa),
+    BENCH_CASE(ethiopic_to_jdn_soa),
+    BENCH_CASE(jdn_to_gregorian_soa),
+    BENCH_CASE(jdn_to_ethiopic_soa),
+};
+
+#define BENCH_CASE_COUNT (sizeof(bench_cases) / sizeof(bench_cases[0]))
+
+/*
+ * Input patterns
+ */
+typedef enum {
+    PATTERN_SEQUENTIAL,
+    PATTERN_RANDOM,
+    PATTERN_CLUSTERED,
+    PATTERN_COUNT
+} bench_pattern_t;
+
+static const char* const pattern_names[PATTERN_COUNT] = {"sequential", "random", "clustered"};
+
+// xorshift64*, so runs are reproducible across platforms
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+
+static uint64_t next_random(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1DULL;
+}
+
+static void fill_input(bench_input_t* in, bench_pattern_t pattern) {
+    int64_t first, span;
+    switch (pattern) {
+    case PATTERN_SEQUENTIAL:
+        first = gregorian_to_jdn(2000, 1, 1);
+        span = 0;
+        break;
+    case PATTERN_RANDOM:
+        first = 0;                                              // 1 January 4713 BC (Julian)
+        span = gregorian_to_jdn(9999, 12, 31) + 1;
+        break;
+    default:
+        first = gregorian_to_jdn(1900, 1, 1);
+        span = gregorian_to_jdn(2100, 12, 31) - first + 1;
+        break;
+    }
+
+    for (int i = 0; i < BENCH_DAYS; i++) {
+        int64_t jdn = (span == 0) ? first + i : first + (int64_t)(next_random() % (uint64_t)span);
+        in->jdn[i] = jdn;
+        in->gregorian[i] = jdn_to_gregorian(jdn);
+        in->ethiopic[i] = jdn_to_ethiopic(jdn, era);
+        in->greg_years[i] = in->gregorian[i].year;
+        in->greg_months[i] = in->gregorian[i].month;
+        in->greg_days[i] = in->gregorian[i].day;
+        in->eth_years[i] = in->ethiopic[i].year;
+        in->eth_months[i] = in->ethiopic[i].month;
+        in->eth_days[i] = in->ethiopic[i].day;
+    }
+}
+
+/*
+ * Runner
+ */
+typedef struct {
+    char name[96];
+    const char* function;
+    const char* pattern;
+    int threads;
+    int64_t iterations;     // conversions per thread
+    double ns_per_op;       // wall time per conversion, as seen by one thread
+    double items_per_second;// conversions per second across all threads
+} bench_result_t;
+
+typedef struct {
+    const bench_case_t* bench;
+    const bench_input_t* input;
+    int64_t passes;
+    int64_t checksum;
+} bench_worker_t;
+
+static volatile int64_t bench_sink;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void* run_worker(void* arg) {
+    bench_worker_t* worker = (bench_worker_t*)arg;
+    bench_output_t* out = (bench_output_t*)malloc(sizeof(bench_output_t));
+    if (out == NULL) {
+        return NULL;
+    }
+
+    int64_t acc = 0;
+    for (int64_t p = 0; p < worker->passes; p++) {
+        acc += worker->bench->loop(worker->input, out);
+    }
+    worker->checksum = acc;
+    free(out);
+    return NULL;
+}
+
+static int run_threads(const bench_case_t* bench, const bench_input_t* input,
+                       int64_t passes, int threads, double* elapsed_ns) {
+    pthread_t ids[256];
+    bench_worker_t workers[256];
+
+    double start = now_ns();
+    for (int t = 0; t < threads; t++) {
+        workers[t].bench = bench;
+        workers[t].input = input;
+        workers[t].passes = passes;
+        workers[t].checksum = 0;
+        if (threads == 1) {
+            run_worker(&workers[t]);
+        } else if (pthread_create(&ids[t], NULL, run_worker, &workers[t]) != 0) {
+            return -1;
+        }
+    }
+    for (int t = 0; t < threads && threads > 1; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    *elapsed_ns = now_ns() - start;
+
+    for (int t = 0; t < threads; t++) {
+        bench_sink += workers[t].checksum;
+    }
+    return 0;
+}
+
+static int run_case(const bench_case_t* bench, const bench_input_t* input, bench_pattern_t pattern,
+                    int threads, double min_time_ns, bench_result_t* result) {
+    // One warm-up pass (also builds the year table), then size the run to min_time
+    double elapsed;
+    if (run_threads(bench, input, 1, 1, &elapsed) != 0) return -1;
+
+    int64_t passes = 1;
+    while (1) {
+        if (run_threads(bench, input, passes, threads, &elapsed) != 0) return -1;
+        if (elapsed >= min_time_ns || passes >= (INT64_C(1) << 40)) break;
+        double scale = (elapsed > 0) ? 1.4 * min_time_ns / elapsed : 10.0;
+        int64_t next = (int64_t)((double)passes * (scale > 10.0 ? 10.0 : scale));
+        passes = (next > passes) ? next : passes + 1;
+    }
+
+    snprintf(result->name, sizeof(result->name), "%s/%s/threads:%d",
+             bench->name, pattern_names[pattern], threads);
+    result->function = bench->name;
+    result->pattern = pattern_names[pattern];
+    result->threads = threads;
+    result->iterations = passes * BENCH_DAYS;
+    result->ns_per_op = elapsed / (double)result->iterations;
+    result->items_per_second = (double)result->iterations * threads / (elapsed * 1e-9);
+    return 0;
+}
+
+/*
+ * Reporting
+ */
+static const char* simd_level_name(int level) {
+    switch (level) {
+    case ETHIOPIC_SIMD_AVX512: return "avx512";
+    case ETHIOPIC_SIMD_AVX2:   return "avx2";
+    default:                   return "scalar";
+    }
+}
+
+static void print_console_header(void) {
+    printf("%-60s %12s %14s %16s\n", "Benchmark", "Time", "Iterations", "Conversions/s");
+    printf("%.*s\n", 105, "-----------------------------------------------------------------------"
+                          "----------------------------------------------------");
+}
+
+static void print_console_row(const bench_result_t* r) {
+    printf("%-60s %9.2f ns %14lld %14.1fM/s\n", r->name, r->ns_per_op,
+           (long long)r->iterations, r->items_per_second / 1e6);
+    fflush(stdout);
+}
+
+static void write_json(FILE* f, const bench_result_t* results, size_t count, int cpus) {
+    char date[64];
+    time_t now = time(NULL);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+    fprintf(f, "{\n  \"context\": {\n");
+    fprintf(f, "    \"date\": \"%s\",\n", date);
+    fprintf(f, "    \"executable\": \"bench_ethiopic_calendar\",\n");
+    fprintf(f, "    \"num_cpus\": %d,\n", cpus);
+    fprintf(f, "    \"simd_level\": \"%s\",\n", simd_level_name(ethiopic_simd_level()));
+    fprintf(f, "    \"batch_size\": %d,\n", BENCH_DAYS);
+    fprintf(f, "    \"table_first_year\": %d,\n", ETHIOPIC_TABLE_FIRST_YEAR);
+    fprintf(f, "    \"table_last_year\": %d\n", ETHIOPIC_TABLE_LAST_YEAR);
+    fprintf(f, "  },\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < count; i++) {
+        const bench_result_t* r = &results[i];
+        fprintf(f, "    {\n");
+        fprintf(f, "      \"name\": \"%s\",\n", r->name);
+        fprintf(f, "      \"run_name\": \"%s\",\n", r->name);
+        fprintf(f, "      \"run_type\": \"iteration\",\n");
+        fprintf(f, "      \"function\": \"%s\",\n", r->function);
+        fprintf(f, "      \"input\": \"%s\",\n", r->pattern);
+        fprintf(f, "      \"threads\": %d,\n", r->threads);
+        fprintf(f, "      \"iterations\": %lld,\n", (long long)r->iterations);
+        fprintf(f, "      \"real_time\": %.4f,\n", r->ns_per_op);
+        fprintf(f, "      \"time_unit\": \"ns\",\n");
+        fprintf(f, "      \"items_per_second\": %.1f\n", r->items_per_second);
+        fprintf(f, "    }%s\n", (i + 1 < count) ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+}
+
+static const char* flag_value(const char* arg, const char* flag) {
+    size_t len = strlen(flag);
+    return (strncmp(arg, flag, len) == 0 && arg[len] == '=') ? arg + len + 1 : NULL;
+}
+
+int main(int argc, char** argv) {
+    const char* filter = NULL;
+    const char* out_path = NULL;
+    double min_time = 0.1;
+    int json = 0;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads = (cpus > 0) ? (int)cpus : 1;
+    const char* value;
+
+    for (int i = 1; i < argc; i++) {
+        if ((value = flag_value(argv[i], "--benchmark_filter")) != NULL) {
+            filter = value;
+        } else if ((value = flag_value(argv[i], "--benchmark_min_time")) != NULL) {
+            min_time = atof(value);
+        } else if ((value = flag_value(argv[i], "--benchmark_format")) != NULL) {
+            json = (strcmp(value, "json") == 0);
+        } else if ((value = flag_value(argv[i], "--benchmark_out")) != NULL) {
+            out_path = value;
+        } else if ((value = flag_value(argv[i], "--threads")) != NULL) {
+            threads = atoi(value);
+        } else if ((value = flag_value(argv[i], "--simd")) != NULL) {
+            ethiopic_set_simd_level(strcmp(value, "avx512") == 0 ? ETHIOPIC_SIMD_AVX512 :
+                                    strcmp(value, "avx2") == 0 ? ETHIOPIC_SIMD_AVX2 : ETHIOPIC_SIMD_SCALAR);
+        } else {
+            fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (threads < 1) threads = 1;
+    if (threads > 256) threads = 256;
+
+    int thread_counts[2] = {1, threads};
+    int thread_runs = (threads > 1) ? 2 : 1;
+    size_t max_results = BENCH_CASE_COUNT * PATTERN_COUNT * 2;
+    bench_result_t* results = (bench_result_t*)calloc(max_results, sizeof(bench_result_t));
+    bench_input_t* input = (bench_input_t*)malloc(sizeof(bench_input_t));
+    if (results == NULL || input == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    if (!json) {
+        printf("bench_ethiopic_calendar: %ld CPUs, SIMD level %s, %d conversions per pass\n\n",
+               cpus, simd_level_name(ethiopic_simd_level()), BENCH_DAYS);
+        print_console_header();
+    }
+
+    size_t count = 0;
+    for (int p = 0; p < PATTERN_COUNT; p++) {
+        fill_input(input, (bench_pattern_t)p);
+        for (size_t c = 0; c < BENCH_CASE_COUNT; c++) {
+            for (int t = 0; t < thread_runs; t++) {
+                bench_result_t* r = &results[count];
+                char name[96];
+                snprintf(name, sizeof(name), "%s/%s/threads:%d",
+                         bench_cases[c].name, pattern_names[p], thread_counts[t]);
+                if (filter != NULL && strstr(name, filter) == NULL) continue;
+
+                if (run_case(&bench_cases[c], input, (bench_pattern_t)p, thread_counts[t],
+                             min_time * 1e9, r) != 0) {
+                    fprintf(stderr, "Failed to start benchmark threads\n");
+                    return 1;
+                }
+                if (!json) print_console_row(r);
+                count++;
+            }
+        }
+    }
+
+    if (json) {
+        write_json(stdout, results, count, (int)cpus);
+    }
+    if (out_path != NULL) {
+        FILE* f = fopen(out_path, "w");
+        if (f == NULL) {
+            fprintf(stderr, "Cannot write %s\n", out_path);
+            return 1;
+        }
+        write_json(f, results, count, (int)cpus);
+        fclose(f);
+    }
+
+    free(input);
+    free(results);
+    return 0;
+}
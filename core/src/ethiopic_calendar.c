@@ -117,11 +117,14 @@ date_t jdn_to_gregorian(int64_t jdn) {
     
     // Calculate cycle remainders
     int64_t offset_jdn = jdn - JD_EPOCH_OFFSET_GREGORIAN;
-    int64_t r2000 = mod(offset_jdn, GREGORIAN_DAYS_PER_2000_YEARS);
     int64_t r400 = mod(offset_jdn, GREGORIAN_DAYS_PER_400_YEARS);
     int64_t r100 = mod(r400, GREGORIAN_DAYS_PER_100_YEARS);
     int64_t r4 = mod(r100, GREGORIAN_DAYS_PER_4_YEARS);
     
+    // The last day of a 400-year cycle (Dec 31 of a year divisible by 400)
+    // wraps r100 back to zero and must be pulled back into the leap year
+    int64_t cycle_end = (r400 == GREGORIAN_DAYS_PER_400_YEARS - 1);
+    
     // Calculate days and leap adjustments
     int64_t n = mod(r4, 365) + 365 * floor_div(r4, 1460);
     int64_t s = floor_div(r4, 1095);
@@ -132,7 +135,7 @@ date_t jdn_to_gregorian(int64_t jdn) {
                      4 * floor_div(r100, GREGORIAN_DAYS_PER_4_YEARS) + 
                      floor_div(r4, 365) - 
                      floor_div(r4, 1460) - 
-                     floor_div(r2000, 730484);
+                     cycle_end;
     
     result.year = (int32_t)(aprime + 1);
     
@@ -141,7 +144,7 @@ date_t jdn_to_gregorian(int64_t jdn) {
     result.month = (int32_t)(t * (floor_div(n, 31) + 1) + 
                             (1 - t) * (floor_div(5 * (n - s) + 13, 153) + 1));
     
-    n += 1 - floor_div(r2000, 730484);
+    n += 1 - cycle_end;
     result.day = (int32_t)n;
     
     // Handle special century boundary case
@@ -152,9 +155,11 @@ date_t jdn_to_gregorian(int64_t jdn) {
         // Adjust for leap year
         days_in_month[2] = is_gregorian_leap(result.year) ? 29 : 28;
         
-        // Find correct month and day
+        // Find correct month and day; the month estimate above assumes a leap
+        // year in every fourth year, which is off by one in common century years
         for (int i = 1; i <= 12; i++) {
             if (n <= days_in_month[i]) {
+                result.month = i;
                 result.day = (int32_t)n;
                 break;
             }
@@ -165,6 +170,255 @@ date_t jdn_to_gregorian(int64_t jdn) {
     return result;
 }
 
+/*
+ * Euclidean affine functions (Neri & Schneider, "Euclidean affine functions
+ * and their application to calendar algorithms", 2022)
+ *
+ * Counting days from 1 March of year 0 makes the leap day the last day of the
+ * year, after which years, months and days all follow from divisions by
+ * constants. JDNs are shifted by a whole number of 400-year cycles so that
+ * [ETHIOPIC_FAST_JDN_MIN, ETHIOPIC_FAST_JDN_MAX] maps onto [0, 2^30) and every
+ * step fits unsigned 32-bit arithmetic, with each division written as a
+ * multiply-high and shift.
+ */
+#define EAF_MARCH_1_YEAR_0   1721120L
+#define EAF_CYCLES_SHIFTED   3687
+#define EAF_JDN_SHIFT        (EAF_CYCLES_SHIFTED * (int64_t)GREGORIAN_DAYS_PER_400_YEARS - EAF_MARCH_1_YEAR_0)
+#define EAF_JDN_WINDOW       ((int64_t)1 << 30)
+#define EAF_YEAR_SHIFT       (400 * EAF_CYCLES_SHIFTED)
+
+// The window published in the header must be exactly the shifted range
+typedef char eaf_window_matches_header[(EAF_JDN_SHIFT == -ETHIOPIC_FAST_JDN_MIN &&
+                                        EAF_JDN_WINDOW - 1 - EAF_JDN_SHIFT == ETHIOPIC_FAST_JDN_MAX) ? 1 : -1];
+
+/**
+ * Converts Julian Day Number to Gregorian date without divisions or branches
+ * JDNs outside the fast window are passed to jdn_to_gregorian, so the result
+ * always equals jdn_to_gregorian(jdn)
+ */
+date_t jdn_to_gregorian_fast(int64_t jdn) {
+    date_t result;
+    uint64_t shifted = (uint64_t)jdn + (uint64_t)EAF_JDN_SHIFT;
+    
+    if (shifted >= (uint64_t)EAF_JDN_WINDOW) {
+        return jdn_to_gregorian(jdn);
+    }
+    
+    // Century and day of century: n1 / 146097 as a multiply-high and shift
+    uint32_t n1 = 4 * (uint32_t)shifted + 3;
+    uint32_t c = (uint32_t)(((uint64_t)n1 * 963315389u) >> 47);
+    uint32_t nc = (n1 - c * GREGORIAN_DAYS_PER_400_YEARS) / 4;
+    
+    // Year of century and day of year, counted from 1 March
+    uint32_t n2 = 4 * nc + 3;
+    uint32_t z = (uint32_t)(((uint64_t)n2 * 2939745u) >> 32);
+    uint32_t ny = nc - z * 1461 / 4;
+    
+    // Month and day: (n3 % 2^16) / 2141 as a multiply and shift
+    uint32_t n3 = 2141 * ny + 197913;
+    uint32_t jan_feb = ny >= 306;
+    
+    result.year = (int32_t)(100 * c + z + jan_feb) - EAF_YEAR_SHIFT;
+    result.month = (int32_t)((n3 >> 16) - 12 * jan_feb);
+    result.day = (int32_t)((((n3 & 0xFFFF) * 31345) >> 26) + 1);
+    
+    return result;
+}
+
+/*
+ * Division-free Ethiopian conversions
+ *
+ * The Ethiopian calendar is a plain 1461-day cycle of 13 months with 30-day
+ * months and the leap day at the end of every fourth year, so the same affine
+ * treatment applies: days since the era are shifted by a whole number of
+ * cycles into [0, 2^30), after which year, month and day are multiplies and
+ * shifts on unsigned 32-bit values.
+ */
+#define EAF_ETHIOPIC_CYCLES_SHIFTED  367468
+#define EAF_ETHIOPIC_SHIFT   (EAF_ETHIOPIC_CYCLES_SHIFTED * (int64_t)ETHIOPIC_DAYS_PER_4_YEARS)
+
+typedef char eaf_ethiopic_window_matches_header[(EAF_ETHIOPIC_SHIFT == -ETHIOPIC_FAST_ERA_DAYS_MIN &&
+                                                 EAF_JDN_WINDOW - 1 - EAF_ETHIOPIC_SHIFT ==
+                                                 ETHIOPIC_FAST_ERA_DAYS_MAX) ? 1 : -1];
+
+/**
+ * Converts Ethiopian date to Julian Day Number without divisions or branches
+ * floor(year / 4) is taken on year + 2^31, which is never negative
+ */
+int64_t ethiopic_to_jdn_fast(int32_t year, int32_t month, int32_t day, int64_t era) {
+    int64_t leap_days = (int64_t)(((uint32_t)year + 0x80000000u) >> 2) - 0x20000000;
+    return era + 365 * (int64_t)year + leap_days + 30 * month + day - 31;
+}
+
+/**
+ * Converts Julian Day Number to Ethiopian date without divisions or branches
+ * Days outside the fast window are passed to jdn_to_ethiopic, so the result
+ * always equals jdn_to_ethiopic(jdn, era)
+ */
+date_t jdn_to_ethiopic_fast(int64_t jdn, int64_t era) {
+    date_t result;
+    uint64_t shifted = (uint64_t)jdn - (uint64_t)era + (uint64_t)EAF_ETHIOPIC_SHIFT;
+    
+    if (shifted >= (uint64_t)EAF_JDN_WINDOW) {
+        return jdn_to_ethiopic(jdn, era);
+    }
+    
+    // Year: n1 / 1461 as a multiply-high and shift; the day of the year is
+    // the remainder / 4, with the leap day landing on Pagume 6
+    uint32_t n1 = 4 * (uint32_t)shifted + 3;
+    uint32_t year = (uint32_t)(((uint64_t)n1 * 376287347u) >> 39);
+    uint32_t doy = (n1 - year * ETHIOPIC_DAYS_PER_4_YEARS) / 4;
+    
+    // Month: doy / 30 as a multiply and shift
+    uint32_t month = (doy * 547) >> 14;
+    
+    result.year = (int32_t)year - 4 * EAF_ETHIOPIC_CYCLES_SHIFTED;
+    result.month = (int32_t)month + 1;
+    result.day = (int32_t)(doy - month * ETHIOPIC_DAYS_PER_MONTH) + 1;
+    
+    return result;
+}
+
+/*
+ * Year-start lookup table
+ *
+ * Holds the JDN of 1 January for every Gregorian year and of 1 Meskerem (AM)
+ * for every Ethiopian year of the table window, plus one sentinel year each.
+ * Inside the window a conversion is a table load plus a subtraction; the year
+ * of a JDN is estimated from the mean year length and corrected by at most one
+ * comparison.
+ */
+#define TABLE_GREGORIAN_YEARS  (ETHIOPIC_TABLE_LAST_YEAR - ETHIOPIC_TABLE_FIRST_YEAR + 1)
+#define TABLE_ETHIOPIC_YEARS   (ETHIOPIC_TABLE_LAST_ETHIOPIC_YEAR - ETHIOPIC_TABLE_FIRST_ETHIOPIC_YEAR + 1)
+
+typedef char year_table_window_is_valid[(TABLE_GREGORIAN_YEARS > 0) ? 1 : -1];
+
+static int32_t gregorian_year_start[TABLE_GREGORIAN_YEARS + 1];
+static int32_t ethiopic_year_start[TABLE_ETHIOPIC_YEARS + 1];
+// Published with release/acquire atomics on GCC/Clang; MSVC gives volatile accesses
+// the same ordering on x86/x64
+static volatile int year_table_ready = 0;
+
+// Days before each Gregorian month in a common year
+static const int32_t days_before_month[] = {0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+/**
+ * Builds the year-start table; safe to call more than once and from several threads,
+ * since every call stores the same values
+ */
+void ethiopic_year_table_init(void) {
+    for (int i = 0; i <= TABLE_GREGORIAN_YEARS; i++) {
+        gregorian_year_start[i] = (int32_t)gregorian_to_jdn(ETHIOPIC_TABLE_FIRST_YEAR + i, 1, 1);
+    }
+    for (int i = 0; i <= TABLE_ETHIOPIC_YEARS; i++) {
+        ethiopic_year_start[i] = (int32_t)ethiopic_to_jdn_fast(ETHIOPIC_TABLE_FIRST_ETHIOPIC_YEAR + i, 1, 1,
+                                                               JD_EPOCH_OFFSET_AMETE_MIHRET);
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_store_n(&year_table_ready, 1, __ATOMIC_RELEASE);
+#else
+    year_table_ready = 1;
+#endif
+}
+
+static void ensure_year_table(void) {
+#if defined(__GNUC__) || defined(__clang__)
+    if (!__atomic_load_n(&year_table_ready, __ATOMIC_ACQUIRE)) {
+#else
+    if (!year_table_ready) {
+#endif
+        ethiopic_year_table_init();
+    }
+}
+
+/**
+ * Gregorian to Julian Day Number through the year-start table
+ */
+int64_t gregorian_to_jdn_table(int32_t year, int32_t month, int32_t day) {
+    uint32_t index = (uint32_t)(year - ETHIOPIC_TABLE_FIRST_YEAR);
+    if (index >= TABLE_GREGORIAN_YEARS || month < 1 || month > 12) {
+        return gregorian_to_jdn(year, month, day);
+    }
+    ensure_year_table();
+    
+    int32_t start = gregorian_year_start[index];
+    int32_t leap_day = (month > 2) && (gregorian_year_start[index + 1] - start == 366);
+    return start + days_before_month[month] + leap_day + day - 1;
+}
+
+/**
+ * Ethiopian to Julian Day Number through the year-start table
+ */
+int64_t ethiopic_to_jdn_table(int32_t year, int32_t month, int32_t day, int64_t era) {
+    uint32_t index = (uint32_t)(year - ETHIOPIC_TABLE_FIRST_ETHIOPIC_YEAR);
+    if (index >= TABLE_ETHIOPIC_YEARS || era != JD_EPOCH_OFFSET_AMETE_MIHRET) {
+        return ethiopic_to_jdn_fast(year, month, day, era);
+    }
+    ensure_year_table();
+    
+    return ethiopic_year_start[index] + 30 * (month - 1) + day - 1;
+}
+
+/**
+ * Julian Day Number to Gregorian date through the year-start table
+ */
+date_t jdn_to_gregorian_table(int64_t jdn) {
+    ensure_year_table();
+    
+    uint64_t offset = (uint64_t)jdn - (uint64_t)gregorian_year_start[0];
+    if (offset >= (uint64_t)(gregorian_year_start[TABLE_GREGORIAN_YEARS] - gregorian_year_start[0])) {
+        return jdn_to_gregorian_fast(jdn);
+    }
+    
+    // The mean-year estimate is off by at most one year in either direction
+    uint32_t index = (uint32_t)(4 * offset / ETHIOPIC_DAYS_PER_4_YEARS);
+    index -= (index == TABLE_GREGORIAN_YEARS);
+    index -= (jdn < gregorian_year_start[index]);
+    index += (jdn >= gregorian_year_start[index + 1]);
+    
+    int32_t start = gregorian_year_start[index];
+    uint32_t doy = (uint32_t)(jdn - start);
+    uint32_t jan_feb_days = 59 + (gregorian_year_start[index + 1] - start == 366);
+    
+    // Day of year counted from 1 March, then the Euclidean affine month/day split
+    uint32_t ny = (doy >= jan_feb_days) ? doy - jan_feb_days : doy + 306;
+    uint32_t n3 = 2141 * ny + 197913;
+    uint32_t jan_feb = ny >= 306;
+    
+    date_t result;
+    result.year = ETHIOPIC_TABLE_FIRST_YEAR + (int32_t)index;
+    result.month = (int32_t)((n3 >> 16) - 12 * jan_feb);
+    result.day = (int32_t)((((n3 & 0xFFFF) * 31345) >> 26) + 1);
+    return result;
+}
+
+/**
+ * Julian Day Number to Ethiopian date through the year-start table
+ */
+date_t jdn_to_ethiopic_table(int64_t jdn, int64_t era) {
+    ensure_year_table();
+    
+    uint64_t offset = (uint64_t)jdn - (uint64_t)ethiopic_year_start[0];
+    if (era != JD_EPOCH_OFFSET_AMETE_MIHRET ||
+        offset >= (uint64_t)(ethiopic_year_start[TABLE_ETHIOPIC_YEARS] - ethiopic_year_start[0])) {
+        return jdn_to_ethiopic_fast(jdn, era);
+    }
+    
+    uint32_t index = (uint32_t)(4 * offset / ETHIOPIC_DAYS_PER_4_YEARS);
+    index -= (index == TABLE_ETHIOPIC_YEARS);
+    index -= (jdn < ethiopic_year_start[index]);
+    index += (jdn >= ethiopic_year_start[index + 1]);
+    
+    uint32_t doy = (uint32_t)(jdn - ethiopic_year_start[index]);
+    uint32_t month = (doy * 547) >> 14;
+    
+    date_t result;
+    result.year = ETHIOPIC_TABLE_FIRST_ETHIOPIC_YEAR + (int32_t)index;
+    result.month = (int32_t)month + 1;
+    result.day = (int32_t)(doy - month * ETHIOPIC_DAYS_PER_MONTH) + 1;
+    return result;
+}
+
 /**
  * Automatically determines the correct era based on JDN
  * Returns AM for dates >= 5500 EC, AA for earlier dates
@@ -179,8 +433,8 @@ int64_t guess_era(int64_t jdn) {
  * High-level Ethiopian to Gregorian conversion
  */
 date_t ethiopic_to_gregorian(int32_t year, int32_t month, int32_t day, int64_t era) {
-    int64_t jdn = ethiopic_to_jdn(year, month, day, era);
-    return jdn_to_gregorian(jdn);
+    int64_t jdn = ethiopic_to_jdn_fast(year, month, day, era);
+    return jdn_to_gregorian_fast(jdn);
 }
 
 /**
@@ -189,5 +443,340 @@ date_t ethiopic_to_gregorian(int32_t year, int32_t month, int32_t day, int64_t e
 date_t gregorian_to_ethiopic(int32_t year, int32_t month, int32_t day) {
     int64_t jdn = gregorian_to_jdn(year, month, day);
     int64_t era = guess_era(jdn);
-    return jdn_to_ethiopic(jdn, era);
+    return jdn_to_ethiopic_fast(jdn, era);
+}
+
+/*
+ * Vectorized Julian Day Number to Gregorian conversion
+ *
+ * The SIMD kernels evaluate the same Euclidean affine form as
+ * jdn_to_gregorian_fast on unsigned 32-bit lanes, converting 8 (AVX2) or
+ * 16 (AVX-512) dates per pass. Any block containing a JDN outside the fast
+ * window is converted element by element instead, so the kernels agree with
+ * jdn_to_gregorian bit for bit everywhere.
+ */
+#if !defined(ETHIOPIC_NO_SIMD) && (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define ETHIOPIC_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+/**
+ * Scalar conversion of a JDN column, used for tails, out-of-window blocks and
+ * CPUs without a vector kernel
+ */
+static void jdn_to_gregorian_scalar(const int64_t* jdn, int32_t* years, int32_t* months,
+                                    int32_t* days, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        date_t g = jdn_to_gregorian_fast(jdn[i]);
+        years[i] = g.year;
+        months[i] = g.month;
+        days[i] = g.day;
+    }
+}
+
+#ifdef ETHIOPIC_X86_DISPATCH
+
+/**
+ * High 32 bits of the unsigned 32x32-bit product in each AVX2 lane
+ */
+__attribute__((target("avx2")))
+static __m256i mulhi_epu32_avx2(__m256i a, __m256i b) {
+    __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+    __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(even, odd, 0xAA);
+}
+
+/**
+ * AVX2 kernel: 8 dates per iteration, returns the number of elements consumed
+ */
+__attribute__((target("avx2")))
+static size_t jdn_to_gregorian_avx2(const int64_t* jdn, int32_t* years, int32_t* months,
+                                    int32_t* days, size_t n) {
+    const __m256i shift = _mm256_set1_epi64x(EAF_JDN_SHIFT);
+    const __m256i outside = _mm256_set1_epi64x(~(EAF_JDN_WINDOW - 1));
+    const __m256i narrow = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    const __m256i three = _mm256_set1_epi32(3);
+    size_t i = 0;
+    
+    for (; i + 8 <= n; i += 8) {
+        __m256i lo = _mm256_add_epi64(_mm256_loadu_si256((const __m256i*)(jdn + i)), shift);
+        __m256i hi = _mm256_add_epi64(_mm256_loadu_si256((const __m256i*)(jdn + i + 4)), shift);
+        if (!_mm256_testz_si256(_mm256_or_si256(lo, hi), outside)) {
+            jdn_to_gregorian_scalar(jdn + i, years + i, months + i, days + i, 8);
+            continue;
+        }
+        __m256i d = _mm256_permute2x128_si256(_mm256_permutevar8x32_epi32(lo, narrow),
+                                              _mm256_permutevar8x32_epi32(hi, narrow), 0x20);
+        
+        // Century and day of century
+        __m256i n1 = _mm256_add_epi32(_mm256_slli_epi32(d, 2), three);
+        __m256i c = _mm256_srli_epi32(mulhi_epu32_avx2(n1, _mm256_set1_epi32(963315389)), 15);
+        __m256i nc = _mm256_srli_epi32(
+            _mm256_sub_epi32(n1, _mm256_mullo_epi32(c, _mm256_set1_epi32(GREGORIAN_DAYS_PER_400_YEARS))), 2);
+        
+        // Year of century and day of year (March-based)
+        __m256i n2 = _mm256_add_epi32(_mm256_slli_epi32(nc, 2), three);
+        __m256i z = mulhi_epu32_avx2(n2, _mm256_set1_epi32(2939745));
+        __m256i ny = _mm256_sub_epi32(nc, _mm256_srli_epi32(_mm256_mullo_epi32(z, _mm256_set1_epi32(1461)), 2));
+        
+        // Month and day
+        __m256i n3 = _mm256_add_epi32(_mm256_mullo_epi32(ny, _mm256_set1_epi32(2141)), _mm256_set1_epi32(197913));
+        __m256i m = _mm256_srli_epi32(n3, 16);
+        __m256i day = _mm256_srli_epi32(
+            _mm256_mullo_epi32(_mm256_and_si256(n3, _mm256_set1_epi32(0xFFFF)), _mm256_set1_epi32(31345)), 26);
+        
+        // January and February belong to the next civil year
+        __m256i jan_feb = _mm256_cmpgt_epi32(ny, _mm256_set1_epi32(305));
+        __m256i y = _mm256_add_epi32(_mm256_mullo_epi32(c, _mm256_set1_epi32(100)), z);
+        y = _mm256_sub_epi32(_mm256_sub_epi32(y, _mm256_set1_epi32(EAF_YEAR_SHIFT)), jan_feb);
+        m = _mm256_sub_epi32(m, _mm256_and_si256(jan_feb, _mm256_set1_epi32(12)));
+        
+        _mm256_storeu_si256((__m256i*)(years + i), y);
+        _mm256_storeu_si256((__m256i*)(months + i), m);
+        _mm256_storeu_si256((__m256i*)(days + i), _mm256_add_epi32(day, _mm256_set1_epi32(1)));
+    }
+    
+    return i;
+}
+
+/**
+ * High 32 bits of the unsigned 32x32-bit product in each AVX-512 lane
+ */
+__attribute__((target("avx512f")))
+static __m512i mulhi_epu32_avx512(__m512i a, __m512i b) {
+    __m512i even = _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32);
+    __m512i odd = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    return _mm512_mask_blend_epi32(0xAAAA, even, odd);
+}
+
+/**
+ * AVX-512 kernel: 16 dates per iteration, returns the number of elements consumed
+ */
+__attribute__((target("avx512f")))
+static size_t jdn_to_gregorian_avx512(const int64_t* jdn, int32_t* years, int32_t* months,
+                                      int32_t* days, size_t n) {
+    const __m512i shift = _mm512_set1_epi64(EAF_JDN_SHIFT);
+    const __m512i outside = _mm512_set1_epi64(~(EAF_JDN_WINDOW - 1));
+    const __m512i three = _mm512_set1_epi32(3);
+    size_t i = 0;
+    
+    for (; i + 16 <= n; i += 16) {
+        __m512i lo = _mm512_add_epi64(_mm512_loadu_si512((const void*)(jdn + i)), shift);
+        __m512i hi = _mm512_add_epi64(_mm512_loadu_si512((const void*)(jdn + i + 8)), shift);
+        if (_mm512_test_epi64_mask(_mm512_or_si512(lo, hi), outside)) {
+            jdn_to_gregorian_scalar(jdn + i, years + i, months + i, days + i, 16);
+            continue;
+        }
+        __m512i d = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtepi64_epi32(lo)),
+                                       _mm512_cvtepi64_epi32(hi), 1);
+        
+        // Century and day of century
+        __m512i n1 = _mm512_add_epi32(_mm512_slli_epi32(d, 2), three);
+        __m512i c = _mm512_srli_epi32(mulhi_epu32_avx512(n1, _mm512_set1_epi32(963315389)), 15);
+        __m512i nc = _mm512_srli_epi32(
+            _mm512_sub_epi32(n1, _mm512_mullo_epi32(c, _mm512_set1_epi32(GREGORIAN_DAYS_PER_400_YEARS))), 2);
+        
+        // Year of century and day of year (March-based)
+        __m512i n2 = _mm512_add_epi32(_mm512_slli_epi32(nc, 2), three);
+        __m512i z = mulhi_epu32_avx512(n2, _mm512_set1_epi32(2939745));
+        __m512i ny = _mm512_sub_epi32(nc, _mm512_srli_epi32(_mm512_mullo_epi32(z, _mm512_set1_epi32(1461)), 2));
+        
+        // Month and day
+        __m512i n3 = _mm512_add_epi32(_mm512_mullo_epi32(ny, _mm512_set1_epi32(2141)), _mm512_set1_epi32(197913));
+        __m512i m = _mm512_srli_epi32(n3, 16);
+        __m512i day = _mm512_srli_epi32(
+            _mm512_mullo_epi32(_mm512_and_si512(n3, _mm512_set1_epi32(0xFFFF)), _mm512_set1_epi32(31345)), 26);
+        
+        // January and February belong to the next civil year
+        __mmask16 jan_feb = _mm512_cmpgt_epu32_mask(ny, _mm512_set1_epi32(305));
+        __m512i y = _mm512_add_epi32(_mm512_mullo_epi32(c, _mm512_set1_epi32(100)), z);
+        y = _mm512_sub_epi32(y, _mm512_set1_epi32(EAF_YEAR_SHIFT));
+        y = _mm512_mask_add_epi32(y, jan_feb, y, _mm512_set1_epi32(1));
+        m = _mm512_mask_sub_epi32(m, jan_feb, m, _mm512_set1_epi32(12));
+        
+        _mm512_storeu_si512((void*)(years + i), y);
+        _mm512_storeu_si512((void*)(months + i), m);
+        _mm512_storeu_si512((void*)(days + i), _mm512_add_epi32(day, _mm512_set1_epi32(1)));
+    }
+    
+    return i;
+}
+
+/**
+ * Best instruction set supported by this CPU and operating system
+ */
+static ethiopic_simd_level_t detect_simd_level(void) {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return ETHIOPIC_SIMD_AVX512;
+    if (__builtin_cpu_supports("avx2")) return ETHIOPIC_SIMD_AVX2;
+    return ETHIOPIC_SIMD_SCALAR;
+}
+
+// Active kernel level, -1 until first use; detection is idempotent so a
+// relaxed atomic is enough to make concurrent first calls safe
+static int active_simd_level = -1;
+
+ethiopic_simd_level_t ethiopic_simd_level(void) {
+    int level = __atomic_load_n(&active_simd_level, __ATOMIC_RELAXED);
+    if (level < 0) {
+        level = (int)detect_simd_level();
+        __atomic_store_n(&active_simd_level, level, __ATOMIC_RELAXED);
+    }
+    return (ethiopic_simd_level_t)level;
+}
+
+ethiopic_simd_level_t ethiopic_set_simd_level(ethiopic_simd_level_t level) {
+    ethiopic_simd_level_t supported = detect_simd_level();
+    if ((int)level < (int)ETHIOPIC_SIMD_SCALAR) level = ETHIOPIC_SIMD_SCALAR;
+    if ((int)level > (int)supported) level = supported;
+    __atomic_store_n(&active_simd_level, (int)level, __ATOMIC_RELAXED);
+    return level;
+}
+
+#else
+
+ethiopic_simd_level_t ethiopic_simd_level(void) {
+    return ETHIOPIC_SIMD_SCALAR;
+}
+
+ethiopic_simd_level_t ethiopic_set_simd_level(ethiopic_simd_level_t level) {
+    (void)level;
+    return ETHIOPIC_SIMD_SCALAR;
+}
+
+#endif
+
+/**
+ * Converts a JDN column with the fastest kernel selected for this CPU
+ */
+static void jdn_to_gregorian_columns(const int64_t* jdn, int32_t* years, int32_t* months,
+                                     int32_t* days, size_t n) {
+    size_t done = 0;
+#ifdef ETHIOPIC_X86_DISPATCH
+    switch (ethiopic_simd_level()) {
+        case ETHIOPIC_SIMD_AVX512:
+            done = jdn_to_gregorian_avx512(jdn, years, months, days, n);
+            break;
+        case ETHIOPIC_SIMD_AVX2:
+            done = jdn_to_gregorian_avx2(jdn, years, months, days, n);
+            break;
+        default:
+            break;
+    }
+#endif
+    jdn_to_gregorian_scalar(jdn + done, years + done, months + done, days + done, n - done);
+}
+
+/**
+ * Batch Gregorian to Ethiopian conversion with automatic era detection per element
+ * Safe to call in place (out == in): each element is read before it is written
+ */
+void gregorian_to_ethiopic_batch(const date_t* in, date_t* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        date_t g = in[i];
+        out[i] = gregorian_to_ethiopic(g.year, g.month, g.day);
+    }
+}
+
+/**
+ * Batch Ethiopian to Gregorian conversion in a single era
+ * Safe to call in place (out == in): each element is read before it is written
+ */
+void ethiopic_to_gregorian_batch(const date_t* in, date_t* out, size_t n, int64_t era) {
+    for (size_t i = 0; i < n; i++) {
+        date_t e = in[i];
+        out[i] = ethiopic_to_gregorian(e.year, e.month, e.day, era);
+    }
+}
+
+/**
+ * Batch Gregorian to Julian Day Number conversion
+ */
+void gregorian_to_jdn_batch(const date_t* ETHIOPIC_RESTRICT in, int64_t* ETHIOPIC_RESTRICT out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = gregorian_to_jdn(in[i].year, in[i].month, in[i].day);
+    }
+}
+
+/**
+ * Batch Ethiopian to Julian Day Number conversion in a single era
+ */
+void ethiopic_to_jdn_batch(const date_t* ETHIOPIC_RESTRICT in, int64_t* ETHIOPIC_RESTRICT out, size_t n, int64_t era) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = ethiopic_to_jdn_fast(in[i].year, in[i].month, in[i].day, era);
+    }
+}
+
+/**
+ * Batch Julian Day Number to Gregorian conversion
+ * Uses the vectorized kernel selected by ethiopic_simd_level()
+ */
+void jdn_to_gregorian_batch(const int64_t* ETHIOPIC_RESTRICT in, date_t* ETHIOPIC_RESTRICT out, size_t n) {
+    // Run the column kernel over stack-sized chunks, then interleave into date_t
+    enum { CHUNK = 256 };
+    int32_t years[CHUNK], months[CHUNK], days[CHUNK];
+    
+    for (size_t start = 0; start < n; start += CHUNK) {
+        size_t count = (n - start < CHUNK) ? n - start : CHUNK;
+        jdn_to_gregorian_columns(in + start, years, months, days, count);
+        for (size_t i = 0; i < count; i++) {
+            out[start + i].year = years[i];
+            out[start + i].month = months[i];
+            out[start + i].day = days[i];
+        }
+    }
+}
+
+/**
+ * Batch Julian Day Number to Ethiopian conversion in a single era
+ */
+void jdn_to_ethiopic_batch(const int64_t* ETHIOPIC_RESTRICT in, date_t* ETHIOPIC_RESTRICT out, size_t n, int64_t era) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = jdn_to_ethiopic_fast(in[i], era);
+    }
+}
+
+/**
+ * Structure-of-arrays Gregorian to Julian Day Number conversion
+ */
+void gregorian_to_jdn_soa(const int32_t* ETHIOPIC_RESTRICT years, const int32_t* ETHIOPIC_RESTRICT months,
+                          const int32_t* ETHIOPIC_RESTRICT days, int64_t* ETHIOPIC_RESTRICT jdn, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        jdn[i] = gregorian_to_jdn(years[i], months[i], days[i]);
+    }
+}
+
+/**
+ * Structure-of-arrays Ethiopian to Julian Day Number conversion in a single era
+ */
+void ethiopic_to_jdn_soa(const int32_t* ETHIOPIC_RESTRICT years, const int32_t* ETHIOPIC_RESTRICT months,
+                         const int32_t* ETHIOPIC_RESTRICT days, int64_t* ETHIOPIC_RESTRICT jdn, size_t n,
+                         int64_t era) {
+    for (size_t i = 0; i < n; i++) {
+        jdn[i] = ethiopic_to_jdn_fast(years[i], months[i], days[i], era);
+    }
+}
+
+/**
+ * Structure-of-arrays Julian Day Number to Gregorian conversion
+ * Uses the vectorized kernel selected by ethiopic_simd_level()
+ */
+void jdn_to_gregorian_soa(const int64_t* ETHIOPIC_RESTRICT jdn, int32_t* ETHIOPIC_RESTRICT years,
+                          int32_t* ETHIOPIC_RESTRICT months, int32_t* ETHIOPIC_RESTRICT days, size_t n) {
+    jdn_to_gregorian_columns(jdn, years, months, days, n);
+}
+
+/**
+ * Structure-of-arrays Julian Day Number to Ethiopian conversion in a single era
+ */
+void jdn_to_ethiopic_soa(const int64_t* ETHIOPIC_RESTRICT jdn, int32_t* ETHIOPIC_RESTRICT years,
+                         int32_t* ETHIOPIC_RESTRICT months, int32_t* ETHIOPIC_RESTRICT days, size_t n,
+                         int64_t era) {
+    for (size_t i = 0; i < n; i++) {
+        date_t e = jdn_to_ethiopic_fast(jdn[i], era);
+        years[i] = e.year;
+        months[i] = e.month;
+        days[i] = e.day;
+    }
 }
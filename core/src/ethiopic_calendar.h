@@ -3,11 +3,25 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// C99 restrict qualifier, spelled so the header also compiles as C++
+#if defined(__cplusplus) || defined(_MSC_VER)
+#define ETHIOPIC_RESTRICT __restrict
+#else
+#define ETHIOPIC_RESTRICT restrict
+#endif
+
+// Thread safety: every function computes its result from its arguments alone and may be
+// called from any number of threads at once. The only shared state, the year-start and
+// holiday tables and the selected SIMD level, is initialized on first use with atomic
+// publication. The one exception is the Islamic holiday table: set or load it before
+// other threads query holidays or business days.
+
 // Date structure for both calendars
 typedef struct {
     int32_t year;
@@ -29,18 +43,159 @@ typedef struct {
 #define GREGORIAN_DAYS_PER_4_YEARS     1461
 #define GREGORIAN_DAYS_PER_2000_YEARS  730485
 
+// JDN window handled by the division-free fast paths (about +/-1.47 million years);
+// outside it they fall back to the general functions
+#define ETHIOPIC_FAST_JDN_MIN          (-536938519L)
+#define ETHIOPIC_FAST_JDN_MAX          536803304L
+// Window of jdn - era handled by jdn_to_ethiopic_fast without falling back
+#define ETHIOPIC_FAST_ERA_DAYS_MIN     (-536870748L)
+#define ETHIOPIC_FAST_ERA_DAYS_MAX     536871075L
+
+// Year-start lookup table window in Gregorian years (override both with -D at build time).
+// The matching Ethiopian years are those whose 1 Meskerem falls in, or right before, the window.
+#ifndef ETHIOPIC_TABLE_FIRST_YEAR
+#define ETHIOPIC_TABLE_FIRST_YEAR      1900
+#endif
+#ifndef ETHIOPIC_TABLE_LAST_YEAR
+#define ETHIOPIC_TABLE_LAST_YEAR       2100
+#endif
+#define ETHIOPIC_TABLE_FIRST_ETHIOPIC_YEAR  (ETHIOPIC_TABLE_FIRST_YEAR - 8)
+#define ETHIOPIC_TABLE_LAST_ETHIOPIC_YEAR   (ETHIOPIC_TABLE_LAST_YEAR - 7)
+
 // Function declarations
 bool is_gregorian_leap(int32_t year);
 bool is_valid_gregorian_date(int32_t year, int32_t month, int32_t day);
 bool is_valid_ethiopic_date(int32_t year, int32_t month, int32_t day);
 int64_t gregorian_to_jdn(int32_t year, int32_t month, int32_t day);
 int64_t ethiopic_to_jdn(int32_t year, int32_t month, int32_t day, int64_t era);
+int64_t ethiopic_to_jdn_fast(int32_t year, int32_t month, int32_t day, int64_t era);
 date_t jdn_to_gregorian(int64_t jdn);
+date_t jdn_to_gregorian_fast(int64_t jdn);
 date_t jdn_to_ethiopic(int64_t jdn, int64_t era);
+date_t jdn_to_ethiopic_fast(int64_t jdn, int64_t era);
 date_t ethiopic_to_gregorian(int32_t year, int32_t month, int32_t day, int64_t era);
 date_t gregorian_to_ethiopic(int32_t year, int32_t month, int32_t day);
 int64_t guess_era(int64_t jdn);
 
+// Business days: the days of [start_jdn, end_jdn] (both included, in either order) that fall
+// Monday-Friday and, when exclude_holidays is set, are not Ethiopian public holidays (see below).
+// Constant time for any range.
+int64_t business_days_between(int64_t start_jdn, int64_t end_jdn, bool exclude_holidays);
+
+// Holidays, identified by ids 0 .. ethiopic_holiday_count() - 1: the fixed holidays (1 and 17
+// Meskerem, 29 Tahsas, 11 Tir, 23 Yekatit), the movable Orthodox feasts, computed for every
+// year, and the Islamic holidays of the table set below. The holidays of each Ethiopian year
+// are compiled into a 366-bit bitmap, memoized for the years of the year-start table window,
+// so a lookup is one bit test and the next holiday is a find-first-set. Names are the English
+// names used by the bindings.
+#define ETHIOPIC_HOLIDAY_NONE          (-1)
+#define ETHIOPIC_HOLIDAY_PALM_SUNDAY   5    // Hosanna, a week before Easter
+#define ETHIOPIC_HOLIDAY_GOOD_FRIDAY   6    // Siklet
+#define ETHIOPIC_HOLIDAY_EASTER        7    // Fasika
+#define ETHIOPIC_HOLIDAY_EID_AL_FITR   8
+#define ETHIOPIC_HOLIDAY_EID_AL_ADHA   9
+#define ETHIOPIC_HOLIDAY_MAWLID        10
+int32_t ethiopic_holiday_count(void);
+// Name of a holiday id, or NULL for an unknown id
+const char* ethiopic_holiday_name(int32_t id);
+bool is_ethiopic_holiday(int64_t jdn);
+// Id of the holiday on jdn, or ETHIOPIC_HOLIDAY_NONE
+int32_t ethiopic_holiday_id(int64_t jdn);
+// JDN of the first holiday on or after jdn; stores its id in *id unless id is NULL
+int64_t ethiopic_next_holiday(int64_t jdn, int32_t* id);
+// Same for the first holiday strictly after jdn
+int64_t ethiopic_next_holiday_after(int64_t jdn, int32_t* id);
+// JDN of Ethiopian Orthodox Easter (Fasika) in an Ethiopian year (Amete Mihret)
+int64_t ethiopic_easter(int32_t year);
+
+// Islamic holidays depend on the sighting of the moon, so they are supplied as a table of
+// (jdn, id) entries with ids ETHIOPIC_HOLIDAY_EID_AL_FITR .. ETHIOPIC_HOLIDAY_MAWLID. Setting a
+// table replaces the previous one (count 0 clears it). ethiopic_load_islamic_holidays() reads
+// the table from a text file of "YYYY-MM-DD Name" lines with Gregorian dates; '#' starts a
+// comment line. Both return the number of holidays in the new table, or a negative error, in
+// which case the previous table stays.
+#define ETHIOPIC_HOLIDAY_ERROR_IO      (-1)   // the file cannot be read
+#define ETHIOPIC_HOLIDAY_ERROR_FORMAT  (-2)   // a malformed line, unknown name or id
+#define ETHIOPIC_HOLIDAY_ERROR_MEMORY  (-3)
+typedef struct {
+    int64_t jdn;
+    int32_t id;
+} ethiopic_dated_holiday_t;
+int32_t ethiopic_set_islamic_holidays(const ethiopic_dated_holiday_t* holidays, size_t count);
+int32_t ethiopic_load_islamic_holidays(const char* path);
+
+// Range query: writes the holidays of [start_jdn, end_jdn] (both included) to `out` in date
+// order, at most `cap` of them, and returns how many were written. When that is `cap`, more
+// may follow: continue from the day after the last one. Inside the year-start table window
+// this is a binary search in a sorted index of the window's holidays, built on first use.
+size_t ethiopic_holidays_in_range(int64_t start_jdn, int64_t end_jdn, ethiopic_dated_holiday_t* out, size_t cap);
+
+// Month grids for calendar views: ETHIOPIC_GRID_WEEKS rows of Monday-Sunday cells starting
+// with the week of day 1, enough for any month in either calendar. Every cell gets its JDN and
+// holiday id; cells of the adjacent months get day 0. Ethiopian years are Amete Mihret years.
+// Returns false, leaving *out untouched, for an invalid month or calendar.
+#define ETHIOPIC_GRID_WEEKS  6
+typedef enum {
+    ETHIOPIC_GRID_ETHIOPIC = 0,
+    ETHIOPIC_GRID_GREGORIAN = 1
+} ethiopic_grid_calendar_t;
+typedef struct {
+    int32_t days_in_month;
+    int32_t first_weekday;                           // column of day 1, 0 = Monday
+    int32_t weeks;                                   // rows holding days of the month, 1 to 6
+    int64_t jdn[ETHIOPIC_GRID_WEEKS][7];
+    uint8_t day[ETHIOPIC_GRID_WEEKS][7];             // day of the month, 0 outside it
+    int8_t holiday[ETHIOPIC_GRID_WEEKS][7];          // holiday id, or ETHIOPIC_HOLIDAY_NONE
+} ethiopic_month_grid_t;
+bool ethiopic_month_grid(ethiopic_grid_calendar_t calendar, int32_t year, int32_t month,
+                         ethiopic_month_grid_t* out);
+
+// Table-driven conversions: a table load plus a subtraction inside the table window
+// (Amete Mihret era for the Ethiopian side), the arithmetic fast paths outside it.
+// The table is built on first use; call ethiopic_year_table_init() to build it up front.
+void ethiopic_year_table_init(void);
+int64_t gregorian_to_jdn_table(int32_t year, int32_t month, int32_t day);
+int64_t ethiopic_to_jdn_table(int32_t year, int32_t month, int32_t day, int64_t era);
+date_t jdn_to_gregorian_table(int64_t jdn);
+date_t jdn_to_ethiopic_table(int64_t jdn, int64_t era);
+
+// Instruction sets used by the vectorized jdn_to_gregorian batch and SoA kernels
+typedef enum {
+    ETHIOPIC_SIMD_SCALAR = 0,
+    ETHIOPIC_SIMD_AVX2 = 1,
+    ETHIOPIC_SIMD_AVX512 = 2
+} ethiopic_simd_level_t;
+
+// Level in use; detected from the CPU on first call
+ethiopic_simd_level_t ethiopic_simd_level(void);
+// Requests a level, clamped to what the CPU supports; returns the level now in use
+ethiopic_simd_level_t ethiopic_set_simd_level(ethiopic_simd_level_t level);
+
+// Batch conversions: element i of `out` is the scalar conversion of element i of `in`.
+// Inputs are not validated, exactly like the scalar functions.
+// Aliasing: the date_t -> date_t variants may be called in place (out == in);
+// every other combination of `in` and `out` must not overlap.
+void gregorian_to_ethiopic_batch(const date_t* in, date_t* out, size_t n);
+void ethiopic_to_gregorian_batch(const date_t* in, date_t* out, size_t n, int64_t era);
+void gregorian_to_jdn_batch(const date_t* ETHIOPIC_RESTRICT in, int64_t* ETHIOPIC_RESTRICT out, size_t n);
+void ethiopic_to_jdn_batch(const date_t* ETHIOPIC_RESTRICT in, int64_t* ETHIOPIC_RESTRICT out, size_t n, int64_t era);
+void jdn_to_gregorian_batch(const int64_t* ETHIOPIC_RESTRICT in, date_t* ETHIOPIC_RESTRICT out, size_t n);
+void jdn_to_ethiopic_batch(const int64_t* ETHIOPIC_RESTRICT in, date_t* ETHIOPIC_RESTRICT out, size_t n, int64_t era);
+
+// Structure-of-arrays conversions over separate year/month/day and JDN columns.
+// Element i of each output column is the scalar conversion of element i of the inputs.
+// No column may overlap any other column.
+void gregorian_to_jdn_soa(const int32_t* ETHIOPIC_RESTRICT years, const int32_t* ETHIOPIC_RESTRICT months,
+                          const int32_t* ETHIOPIC_RESTRICT days, int64_t* ETHIOPIC_RESTRICT jdn, size_t n);
+void ethiopic_to_jdn_soa(const int32_t* ETHIOPIC_RESTRICT years, const int32_t* ETHIOPIC_RESTRICT months,
+                         const int32_t* ETHIOPIC_RESTRICT days, int64_t* ETHIOPIC_RESTRICT jdn, size_t n,
+                         int64_t era);
+void jdn_to_gregorian_soa(const int64_t* ETHIOPIC_RESTRICT jdn, int32_t* ETHIOPIC_RESTRICT years,
+                          int32_t* ETHIOPIC_RESTRICT months, int32_t* ETHIOPIC_RESTRICT days, size_t n);
+void jdn_to_ethiopic_soa(const int64_t* ETHIOPIC_RESTRICT jdn, int32_t* ETHIOPIC_RESTRICT years,
+                         int32_t* ETHIOPIC_RESTRICT months, int32_t* ETHIOPIC_RESTRICT days, size_t n,
+                         int64_t era);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,146 @@
+#ifndef ETHIOPIC_CALENDAR_HPP
+#define ETHIOPIC_CALENDAR_HPP
+
+// Header-only constexpr C++17 mirror of the C core. Every function returns what its
+// C counterpart in ethiopic_calendar.h returns, but can be evaluated at compile time,
+// so fixed-date tables and constants cost nothing at runtime. No linking is needed.
+
+#include "ethiopic_calendar.h"
+
+namespace ethiopic {
+
+// Julian Day Number epoch offsets
+inline constexpr int64_t amete_alem = JD_EPOCH_OFFSET_AMETE_ALEM;
+inline constexpr int64_t amete_mihret = JD_EPOCH_OFFSET_AMETE_MIHRET;
+inline constexpr int64_t gregorian_epoch = JD_EPOCH_OFFSET_GREGORIAN;
+
+namespace detail {
+
+// Floor division and modulo, matching floor_div() and mod() in the C core
+constexpr int64_t floor_div(int64_t a, int64_t b) {
+    return a / b - ((a % b != 0) && ((a < 0) != (b < 0)));
+}
+
+constexpr int64_t mod(int64_t a, int64_t b) {
+    return a - floor_div(a, b) * b;
+}
+
+}  // namespace detail
+
+// Determines if a Gregorian year is a leap year
+constexpr bool is_gregorian_leap(int32_t year) {
+    return (year % 4 == 0) && ((year % 100 != 0) || (year % 400 == 0));
+}
+
+// Determines if an Ethiopian year has a 6-day Pagume
+constexpr bool is_ethiopic_leap(int32_t year) {
+    return (year % 4) == 3;
+}
+
+// Validates a Gregorian date
+constexpr bool is_valid_gregorian_date(int32_t year, int32_t month, int32_t day) {
+    if (month < 1 || month > 12) return false;
+    if (day < 1) return false;
+
+    constexpr int32_t days_in_month[] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    int32_t max_day = days_in_month[month];
+    if (month == 2 && is_gregorian_leap(year)) max_day = 29;
+
+    return day <= max_day;
+}
+
+// Validates an Ethiopian date
+constexpr bool is_valid_ethiopic_date(int32_t year, int32_t month, int32_t day) {
+    if (month < 1 || month > 13) return false;
+    if (day < 1) return false;
+
+    if (month <= 12) {
+        return day <= 30;
+    }
+    return day <= (is_ethiopic_leap(year) ? 6 : 5);
+}
+
+// Converts a Gregorian date to a Julian Day Number
+constexpr int64_t gregorian_to_jdn(int32_t year, int32_t month, int32_t day) {
+    using detail::floor_div;
+
+    int64_t s = floor_div(year, 4) - floor_div(year - 1, 4) -
+                floor_div(year, 100) + floor_div(year - 1, 100) +
+                floor_div(year, 400) - floor_div(year - 1, 400);
+    int64_t t = floor_div(14 - month, 12);
+    int64_t n = 31 * t * (month - 1) +
+                (1 - t) * (59 + s + 30 * (month - 3) + floor_div(3 * month - 7, 5)) +
+                day - 1;
+    return gregorian_epoch +
+           365 * (int64_t)(year - 1) +
+           floor_div(year - 1, 4) -
+           floor_div(year - 1, 100) +
+           floor_div(year - 1, 400) +
+           n;
+}
+
+// Converts an Ethiopian date to a Julian Day Number
+constexpr int64_t ethiopic_to_jdn(int32_t year, int32_t month, int32_t day, int64_t era = amete_mihret) {
+    return era + 365 + 365 * (int64_t)(year - 1) + detail::floor_div(year, 4) + 30 * month + day - 31;
+}
+
+// Converts a Julian Day Number to a Gregorian date (days from civil, inverted)
+constexpr date_t jdn_to_gregorian(int64_t jdn) {
+    using detail::floor_div;
+
+    // Days since 1 March of year 0, split into 400-year eras
+    int64_t z = jdn - 1721120;
+    int64_t era = floor_div(z, GREGORIAN_DAYS_PER_400_YEARS);
+    int64_t doe = z - era * GREGORIAN_DAYS_PER_400_YEARS;
+    int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int64_t mp = (5 * doy + 2) / 153;
+    int64_t month = mp < 10 ? mp + 3 : mp - 9;
+
+    date_t result{};
+    result.year = (int32_t)(yoe + era * 400 + (month <= 2));
+    result.month = (int32_t)month;
+    result.day = (int32_t)(doy - (153 * mp + 2) / 5 + 1);
+    return result;
+}
+
+// Converts a Julian Day Number to an Ethiopian date
+constexpr date_t jdn_to_ethiopic(int64_t jdn, int64_t era = amete_mihret) {
+    using detail::floor_div;
+    using detail::mod;
+
+    int64_t r = mod(jdn - era, ETHIOPIC_DAYS_PER_4_YEARS);
+    int64_t n = mod(r, 365) + 365 * floor_div(r, 1460);
+
+    date_t result{};
+    result.year = (int32_t)(4 * floor_div(jdn - era, ETHIOPIC_DAYS_PER_4_YEARS) +
+                            floor_div(r, 365) - floor_div(r, 1460));
+    result.month = (int32_t)(floor_div(n, ETHIOPIC_DAYS_PER_MONTH) + 1);
+    result.day = (int32_t)(mod(n, ETHIOPIC_DAYS_PER_MONTH) + 1);
+    return result;
+}
+
+// Returns AM for dates >= 5500 EC, AA for earlier dates
+constexpr int64_t guess_era(int64_t jdn) {
+    return (jdn >= amete_mihret + 365) ? amete_mihret : amete_alem;
+}
+
+// High-level Ethiopian to Gregorian conversion
+constexpr date_t ethiopic_to_gregorian(int32_t year, int32_t month, int32_t day, int64_t era = amete_mihret) {
+    return jdn_to_gregorian(ethiopic_to_jdn(year, month, day, era));
+}
+
+// High-level Gregorian to Ethiopian conversion with automatic era detection
+constexpr date_t gregorian_to_ethiopic(int32_t year, int32_t month, int32_t day) {
+    int64_t jdn = gregorian_to_jdn(year, month, day);
+    return jdn_to_ethiopic(jdn, guess_era(jdn));
+}
+
+// Field-wise comparison; date_t is a C struct without operator==
+constexpr bool same_date(const date_t& a, const date_t& b) {
+    return a.year == b.year && a.month == b.month && a.day == b.day;
+}
+
+}  // namespace ethiopic
+
+#endif // ETHIOPIC_CALENDAR_HPP
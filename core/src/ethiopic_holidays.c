@@ -0,0 +1,821 @@
+#include "ethiopic_calendar.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/**
+ * Modulo with a non-negative result, as mod() in ethiopic_calendar.c
+ */
+static int64_t mod(int64_t a, int64_t b) {
+    int64_t result = a % b;
+    return result < 0 ? result + b : result;
+}
+
+/**
+ * Integer floor division, as floor_div() in ethiopic_calendar.c
+ */
+static int64_t floor_div(int64_t a, int64_t b) {
+    return (a - mod(a, b)) / b;
+}
+
+/**
+ * Fixed Ethiopian public holidays, as (month, day) in the Ethiopian calendar;
+ * the index is the holiday id. Names match the keys of ETHIOPIAN_HOLIDAYS in the
+ * Python binding. None falls in Pagume, so each one is exactly day_of_year
+ * days after 1 Meskerem in every year.
+ */
+static const struct {
+    int32_t month;
+    int32_t day;
+    const char* name;
+} fixed_holidays[] = {
+    {1, 1, "Ethiopian New Year"},           // Enkutatash
+    {1, 17, "Finding of the True Cross"},   // Meskel
+    {4, 29, "Ethiopian Christmas"},         // Genna
+    {5, 11, "Epiphany (Timkat)"},           // Timkat
+    {6, 23, "Battle of Adwa"},
+};
+
+#define FIXED_HOLIDAY_COUNT  (sizeof(fixed_holidays) / sizeof(fixed_holidays[0]))
+
+/**
+ * Names of the holidays that move from year to year, from id
+ * ETHIOPIC_HOLIDAY_PALM_SUNDAY on
+ */
+static const char* const movable_holiday_names[] = {
+    "Palm Sunday",   // Hosanna
+    "Good Friday",   // Siklet
+    "Easter",        // Fasika
+    "Eid al-Fitr",
+    "Eid al-Adha",
+    "Mawlid",
+};
+
+#define HOLIDAY_COUNT  (ETHIOPIC_HOLIDAY_PALM_SUNDAY + \
+                        (int32_t)(sizeof(movable_holiday_names) / sizeof(movable_holiday_names[0])))
+
+typedef char holiday_ids_are_valid[((int32_t)FIXED_HOLIDAY_COUNT == ETHIOPIC_HOLIDAY_PALM_SUNDAY &&
+                                    HOLIDAY_COUNT == ETHIOPIC_HOLIDAY_MAWLID + 1) ? 1 : -1];
+
+/**
+ * Weekdays of Ethiopian dates repeat every 28 years: four years are 1461 days,
+ * and 7 * 1461 days is a whole number of weeks. holidays_before_cycle_year[k] is
+ * the number of fixed holidays falling Monday-Friday in years 0 .. k-1 of a cycle
+ * that starts at a year divisible by 28, so any run of whole years is counted
+ * with one table load per end.
+ */
+#define HOLIDAY_CYCLE_YEARS  28
+
+static int32_t holidays_before_cycle_year[HOLIDAY_CYCLE_YEARS + 1];
+
+/**
+ * Holiday bitmap of an Ethiopian year: bit n is set when day n of the year
+ * (1 Meskerem = 0) is a holiday. Bits past the last day of the year stay clear.
+ * The fixed holidays fall on the same days every year and share one bitmap.
+ */
+#define HOLIDAY_BITMAP_WORDS  6   // 366 bits rounded up to whole 64-bit words
+
+static uint64_t fixed_holiday_bitmap[HOLIDAY_BITMAP_WORDS];
+
+// Published like year_table_ready in ethiopic_calendar.c
+static volatile int holiday_table_ready = 0;
+
+/**
+ * Holidays of one Ethiopian year: the fixed holidays, the movable feasts and the
+ * loaded Islamic holidays, plus the day of year of Easter
+ */
+typedef struct {
+    uint64_t bitmap[HOLIDAY_BITMAP_WORDS];
+    int32_t easter;
+} holiday_year_t;
+
+/**
+ * Memoized years of the year-start table window (Amete Mihret years). Each slot is
+ * built on first use by the one thread that moves its state from EMPTY to BUILDING,
+ * and published as READY; other threads, and years outside the window, compute the
+ * year into a caller-provided holiday_year_t instead.
+ */
+#define HOLIDAY_CACHE_FIRST_YEAR  ETHIOPIC_TABLE_FIRST_ETHIOPIC_YEAR
+#define HOLIDAY_CACHE_YEARS       (ETHIOPIC_TABLE_LAST_ETHIOPIC_YEAR - ETHIOPIC_TABLE_FIRST_ETHIOPIC_YEAR + 1)
+
+static holiday_year_t holiday_years[HOLIDAY_CACHE_YEARS];
+static volatile int holiday_year_ready[HOLIDAY_CACHE_YEARS];
+
+#define HOLIDAY_YEAR_EMPTY     0
+#define HOLIDAY_YEAR_BUILDING  1
+#define HOLIDAY_YEAR_READY     2
+
+/**
+ * Islamic holidays follow the lunar Hijri calendar and the sighting of the moon,
+ * so they are not computed: ethiopic_set_islamic_holidays() supplies them. The
+ * entries are sorted by JDN, without duplicate days, and indexed by Ethiopian year
+ * so that each year's entries and the count of those before it are one load away.
+ */
+#define ISLAMIC_MAX_YEARS  10000
+
+static ethiopic_dated_holiday_t* islamic_holidays = NULL;
+static size_t islamic_count = 0;
+static int32_t islamic_first_year = 0;
+static int32_t islamic_years = 0;
+// Index of the first entry of year islamic_first_year + k, for k = 0 .. islamic_years
+static size_t* islamic_year_start = NULL;
+// Entries of earlier years that fall Monday-Friday on a day without another holiday
+static int64_t* islamic_counted_before_year = NULL;
+// Per entry: whether it is one of those days
+static bool* islamic_counted = NULL;
+
+static int32_t holiday_day_of_year(size_t i) {
+    return (fixed_holidays[i].month - 1) * ETHIOPIC_DAYS_PER_MONTH + fixed_holidays[i].day - 1;
+}
+
+// JDN modulo 7 is 0 on Mondays, as in getDayOfWeek() of the bindings
+static bool is_weekday(int64_t jdn) {
+    return mod(jdn, 7) < 5;
+}
+
+/**
+ * Builds the fixed holiday bitmap and the 28-year holiday count table; safe to
+ * call from several threads, since every call stores the same values
+ */
+static void holiday_table_init(void) {
+    int32_t count = 0;
+
+    for (size_t i = 0; i < FIXED_HOLIDAY_COUNT; i++) {
+        int32_t day_of_year = holiday_day_of_year(i);
+        fixed_holiday_bitmap[day_of_year / 64] |= (uint64_t)1 << (day_of_year % 64);
+    }
+    for (int32_t year = 0; year < HOLIDAY_CYCLE_YEARS; year++) {
+        int64_t new_year = ethiopic_to_jdn(year, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET);
+        holidays_before_cycle_year[year] = count;
+        for (size_t i = 0; i < FIXED_HOLIDAY_COUNT; i++) {
+            count += is_weekday(new_year + holiday_day_of_year(i));
+        }
+    }
+    holidays_before_cycle_year[HOLIDAY_CYCLE_YEARS] = count;
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_store_n(&holiday_table_ready, 1, __ATOMIC_RELEASE);
+#else
+    holiday_table_ready = 1;
+#endif
+}
+
+static void ensure_holiday_table(void) {
+#if defined(__GNUC__) || defined(__clang__)
+    if (!__atomic_load_n(&holiday_table_ready, __ATOMIC_ACQUIRE)) {
+#else
+    if (!holiday_table_ready) {
+#endif
+        holiday_table_init();
+    }
+}
+
+/**
+ * Julian calendar date to Julian Day Number
+ */
+static int64_t julian_to_jdn(int64_t year, int64_t month, int64_t day) {
+    int64_t a = (14 - month) / 12;
+    int64_t y = year + 4800 - a;
+    int64_t m = month + 12 * a - 3;
+    return day + (153 * m + 2) / 5 + 365 * y + floor_div(y, 4) - 32083;
+}
+
+/**
+ * Ethiopian Orthodox Easter (Fasika) with the Julian computus of Meeus: the first
+ * Sunday after the Paschal full moon of the 19-year lunar cycle, on or after
+ * 21 March Julian. Ethiopian year Y ends in September of Julian year Y + 8, whose
+ * Easter therefore falls in it, between Megabit and Miyazia.
+ */
+int64_t ethiopic_easter(int32_t year) {
+    int64_t julian_year = (int64_t)year + 8;
+    int64_t a = mod(julian_year, 4);
+    int64_t b = mod(julian_year, 7);
+    int64_t c = mod(julian_year, 19);
+    int64_t d = mod(19 * c + 15, 30);
+    int64_t e = mod(2 * a + 4 * b - d + 34, 7);
+
+    return julian_to_jdn(julian_year, (d + e + 114) / 31, (d + e + 114) % 31 + 1);
+}
+
+static void bitmap_set(uint64_t* bitmap, int64_t day_of_year) {
+    bitmap[day_of_year / 64] |= (uint64_t)1 << (day_of_year % 64);
+}
+
+static bool bitmap_test(const uint64_t* bitmap, int32_t day_of_year) {
+    return (bitmap[day_of_year / 64] >> (day_of_year % 64)) & 1;
+}
+
+/**
+ * Range of Islamic entries falling in an Ethiopian year
+ */
+static void islamic_entries_of_year(int32_t year, size_t* first, size_t* last) {
+    int64_t k = (int64_t)year - islamic_first_year;
+
+    if (k < 0 || k >= islamic_years) {
+        *first = *last = 0;
+        return;
+    }
+    *first = islamic_year_start[k];
+    *last = islamic_year_start[k + 1];
+}
+
+static void holiday_year_build(int32_t year, holiday_year_t* out) {
+    int64_t new_year = ethiopic_to_jdn(year, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    size_t first, last;
+
+    memcpy(out->bitmap, fixed_holiday_bitmap, sizeof(fixed_holiday_bitmap));
+    out->easter = (int32_t)(ethiopic_easter(year) - new_year);
+    bitmap_set(out->bitmap, out->easter - 7);   // Palm Sunday
+    bitmap_set(out->bitmap, out->easter - 2);   // Good Friday
+    bitmap_set(out->bitmap, out->easter);
+
+    islamic_entries_of_year(year, &first, &last);
+    for (size_t i = first; i < last; i++) {
+        bitmap_set(out->bitmap, islamic_holidays[i].jdn - new_year);
+    }
+}
+
+/**
+ * Holidays of an Ethiopian year, from the cache inside the table window and
+ * built into *scratch outside it or while another thread builds the slot, so a
+ * published slot is never written again
+ */
+static const holiday_year_t* holiday_year(int32_t year, holiday_year_t* scratch) {
+    uint32_t index = (uint32_t)(year - HOLIDAY_CACHE_FIRST_YEAR);
+    int state;
+
+    ensure_holiday_table();
+    if (index >= HOLIDAY_CACHE_YEARS) {
+        holiday_year_build(year, scratch);
+        return scratch;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    state = __atomic_load_n(&holiday_year_ready[index], __ATOMIC_ACQUIRE);
+    if (state == HOLIDAY_YEAR_EMPTY) {
+        int expected = HOLIDAY_YEAR_EMPTY;
+        if (__atomic_compare_exchange_n(&holiday_year_ready[index], &expected, HOLIDAY_YEAR_BUILDING, false,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+            holiday_year_build(year, &holiday_years[index]);
+            __atomic_store_n(&holiday_year_ready[index], HOLIDAY_YEAR_READY, __ATOMIC_RELEASE);
+            return &holiday_years[index];
+        }
+        state = expected;
+    }
+#elif defined(_MSC_VER)
+    // Volatile accesses have acquire/release ordering on MSVC, as for year_table_ready
+    state = holiday_year_ready[index];
+    if (state == HOLIDAY_YEAR_EMPTY) {
+        state = (int)_InterlockedCompareExchange((volatile long*)&holiday_year_ready[index],
+                                                 HOLIDAY_YEAR_BUILDING, HOLIDAY_YEAR_EMPTY);
+        if (state == HOLIDAY_YEAR_EMPTY) {
+            holiday_year_build(year, &holiday_years[index]);
+            holiday_year_ready[index] = HOLIDAY_YEAR_READY;
+            return &holiday_years[index];
+        }
+    }
+#else
+    // Without a compare-and-swap the slots cannot be claimed, so they stay unused
+    state = HOLIDAY_YEAR_EMPTY;
+#endif
+    if (state == HOLIDAY_YEAR_READY) {
+        return &holiday_years[index];
+    }
+    holiday_year_build(year, scratch);
+    return scratch;
+}
+
+/**
+ * Index of the lowest set bit of a non-zero word
+ */
+static int lowest_set_bit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return (int)index;
+#else
+    int index = 0;
+    while (!(word & 1)) {
+        word >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * Ethiopian year (Amete Mihret numbering) and day of year of a JDN
+ */
+static int32_t holiday_day_of_jdn(int64_t jdn, int32_t* year) {
+    date_t date = jdn_to_ethiopic_fast(jdn, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    if (year != NULL) {
+        *year = date.year;
+    }
+    return (date.month - 1) * ETHIOPIC_DAYS_PER_MONTH + date.day - 1;
+}
+
+int32_t ethiopic_holiday_count(void) {
+    return HOLIDAY_COUNT;
+}
+
+const char* ethiopic_holiday_name(int32_t id) {
+    if (id < 0 || id >= HOLIDAY_COUNT) {
+        return NULL;
+    }
+    if (id < ETHIOPIC_HOLIDAY_PALM_SUNDAY) {
+        return fixed_holidays[id].name;
+    }
+    return movable_holiday_names[id - ETHIOPIC_HOLIDAY_PALM_SUNDAY];
+}
+
+/**
+ * Whether a JDN is a holiday: one bit test in the bitmap of its year
+ */
+bool is_ethiopic_holiday(int64_t jdn) {
+    holiday_year_t scratch;
+    int32_t year;
+    int32_t day_of_year = holiday_day_of_jdn(jdn, &year);
+    return bitmap_test(holiday_year(year, &scratch)->bitmap, day_of_year);
+}
+
+/**
+ * Id of the holiday on a JDN; the bitmap rules out ordinary days before the
+ * holiday lists are searched
+ */
+int32_t ethiopic_holiday_id(int64_t jdn) {
+    holiday_year_t scratch;
+    int32_t year;
+    int32_t day_of_year = holiday_day_of_jdn(jdn, &year);
+    const holiday_year_t* holidays = holiday_year(year, &scratch);
+    size_t first, last;
+
+    if (!bitmap_test(holidays->bitmap, day_of_year)) {
+        return ETHIOPIC_HOLIDAY_NONE;
+    }
+    if (bitmap_test(fixed_holiday_bitmap, day_of_year)) {
+        for (size_t i = 0; i < FIXED_HOLIDAY_COUNT; i++) {
+            if (holiday_day_of_year(i) == day_of_year) {
+                return (int32_t)i;
+            }
+        }
+    }
+    if (day_of_year == holidays->easter - 7) {
+        return ETHIOPIC_HOLIDAY_PALM_SUNDAY;
+    }
+    if (day_of_year == holidays->easter - 2) {
+        return ETHIOPIC_HOLIDAY_GOOD_FRIDAY;
+    }
+    if (day_of_year == holidays->easter) {
+        return ETHIOPIC_HOLIDAY_EASTER;
+    }
+    islamic_entries_of_year(year, &first, &last);
+    for (size_t i = first; i < last; i++) {
+        if (islamic_holidays[i].jdn == jdn) {
+            return islamic_holidays[i].id;
+        }
+    }
+    return ETHIOPIC_HOLIDAY_NONE;
+}
+
+/**
+ * First holiday on or after a JDN by a find-first-set over the rest of its
+ * year's bitmap, then over the following years' bitmaps
+ */
+static int64_t next_holiday_from_bitmaps(int64_t jdn, int32_t* id) {
+    holiday_year_t scratch;
+    int32_t year;
+    int32_t day_of_year = holiday_day_of_jdn(jdn, &year);
+    int64_t new_year = jdn - day_of_year;
+
+    for (;;) {
+        const uint64_t* bitmap = holiday_year(year, &scratch)->bitmap;
+        for (int32_t word = day_of_year / 64; word < HOLIDAY_BITMAP_WORDS; word++) {
+            uint64_t bits = bitmap[word];
+            if (word == day_of_year / 64) {
+                bits &= ~(uint64_t)0 << (day_of_year % 64);
+            }
+            if (bits != 0) {
+                int64_t holiday = new_year + word * 64 + lowest_set_bit(bits);
+                if (id != NULL) {
+                    *id = ethiopic_holiday_id(holiday);
+                }
+                return holiday;
+            }
+        }
+        // Pagume has 6 days in years before a year divisible by 4
+        new_year += 365 + (mod(year, 4) == 3);
+        year++;
+        day_of_year = 0;
+    }
+}
+
+/**
+ * Sorted JDN index of every holiday in the years of the cache window, for the
+ * range queries: a binary search finds the first holiday of a range and the
+ * rest follow in order. It is built on first use, published with a single
+ * pointer store (a thread that loses the race frees its copy) and dropped when
+ * the Islamic table changes. Queries outside the window walk the bitmaps.
+ */
+typedef struct {
+    int64_t first_jdn;   // 1 Meskerem of the first year of the window
+    int64_t end_jdn;     // 1 Meskerem of the year after the window
+    size_t count;
+    ethiopic_dated_holiday_t entries[];
+} holiday_index_t;
+
+static holiday_index_t* holiday_index = NULL;
+
+static int popcount64(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+    for (; word != 0; word &= word - 1) {
+        count++;
+    }
+    return count;
+#endif
+}
+
+static holiday_index_t* holiday_index_build(void) {
+    holiday_year_t scratch;
+    int64_t first_jdn = ethiopic_to_jdn(HOLIDAY_CACHE_FIRST_YEAR, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    int64_t end_jdn = ethiopic_to_jdn(HOLIDAY_CACHE_FIRST_YEAR + HOLIDAY_CACHE_YEARS, 1, 1,
+                                      JD_EPOCH_OFFSET_AMETE_MIHRET);
+    size_t count = 0;
+
+    for (int32_t k = 0; k < HOLIDAY_CACHE_YEARS; k++) {
+        const uint64_t* bitmap = holiday_year(HOLIDAY_CACHE_FIRST_YEAR + k, &scratch)->bitmap;
+        for (int32_t word = 0; word < HOLIDAY_BITMAP_WORDS; word++) {
+            count += popcount64(bitmap[word]);
+        }
+    }
+
+    holiday_index_t* index = (holiday_index_t*)malloc(sizeof(*index) + count * sizeof(index->entries[0]));
+    if (index == NULL) {
+        return NULL;
+    }
+    index->first_jdn = first_jdn;
+    index->end_jdn = end_jdn;
+    index->count = 0;
+
+    int64_t new_year = first_jdn;
+    for (int32_t k = 0; k < HOLIDAY_CACHE_YEARS; k++) {
+        int32_t year = HOLIDAY_CACHE_FIRST_YEAR + k;
+        const uint64_t* bitmap = holiday_year(year, &scratch)->bitmap;
+        for (int32_t word = 0; word < HOLIDAY_BITMAP_WORDS; word++) {
+            for (uint64_t bits = bitmap[word]; bits != 0; bits &= bits - 1) {
+                int64_t jdn = new_year + word * 64 + lowest_set_bit(bits);
+                index->entries[index->count].jdn = jdn;
+                index->entries[index->count].id = ethiopic_holiday_id(jdn);
+                index->count++;
+            }
+        }
+        new_year += 365 + (mod(year, 4) == 3);
+    }
+    return index;
+}
+
+/**
+ * The holiday index, or NULL when it cannot be allocated
+ */
+static const holiday_index_t* ensure_holiday_index(void) {
+#if defined(__GNUC__) || defined(__clang__)
+    holiday_index_t* index = __atomic_load_n(&holiday_index, __ATOMIC_ACQUIRE);
+    if (index == NULL) {
+        holiday_index_t* expected = NULL;
+        index = holiday_index_build();
+        if (index != NULL &&
+            !__atomic_compare_exchange_n(&holiday_index, &expected, index, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            free(index);
+            index = expected;
+        }
+    }
+#else
+    holiday_index_t* index = holiday_index;
+    if (index == NULL) {
+        index = holiday_index = holiday_index_build();
+    }
+#endif
+    return index;
+}
+
+/**
+ * Position of the first index entry on or after jdn
+ */
+static size_t holiday_index_lower_bound(const holiday_index_t* index, int64_t jdn) {
+    size_t low = 0, high = index->count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (index->entries[middle].jdn < jdn) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+/**
+ * First holiday on or after a JDN: a binary search in the holiday index inside
+ * the cache window, the bitmap walk outside it
+ */
+int64_t ethiopic_next_holiday(int64_t jdn, int32_t* id) {
+    const holiday_index_t* index = ensure_holiday_index();
+
+    if (index != NULL && jdn >= index->first_jdn && jdn < index->end_jdn) {
+        size_t i = holiday_index_lower_bound(index, jdn);
+        if (i < index->count) {
+            if (id != NULL) {
+                *id = index->entries[i].id;
+            }
+            return index->entries[i].jdn;
+        }
+        jdn = index->end_jdn;
+    }
+    return next_holiday_from_bitmaps(jdn, id);
+}
+
+int64_t ethiopic_next_holiday_after(int64_t jdn, int32_t* id) {
+    return ethiopic_next_holiday(jdn + 1, id);
+}
+
+/**
+ * Holidays of a closed JDN range in date order: a binary search for the first
+ * one inside the cache window, then a copy of the following index entries
+ */
+size_t ethiopic_holidays_in_range(int64_t start_jdn, int64_t end_jdn, ethiopic_dated_holiday_t* out, size_t cap) {
+    const holiday_index_t* index = ensure_holiday_index();
+    size_t written = 0;
+
+    while (written < cap && start_jdn <= end_jdn) {
+        if (index != NULL && start_jdn >= index->first_jdn && start_jdn < index->end_jdn) {
+            size_t i = holiday_index_lower_bound(index, start_jdn);
+            for (; i < index->count && index->entries[i].jdn <= end_jdn && written < cap; i++) {
+                out[written++] = index->entries[i];
+            }
+            if (i < index->count) {
+                break;
+            }
+            start_jdn = index->end_jdn;
+            continue;
+        }
+        int32_t id;
+        int64_t holiday = ethiopic_next_holiday(start_jdn, &id);
+        if (holiday > end_jdn) {
+            break;
+        }
+        out[written].jdn = holiday;
+        out[written].id = id;
+        written++;
+        start_jdn = holiday + 1;
+    }
+    return written;
+}
+
+/**
+ * Monday-Friday days before jdn, counted from JDN 0 (negative below it)
+ */
+static int64_t weekdays_before(int64_t jdn) {
+    int64_t rest = mod(jdn, 7);
+    return floor_div(jdn, 7) * 5 + (rest < 5 ? rest : 5);
+}
+
+/**
+ * Holidays falling Monday-Friday before jdn, counted from 1 Meskerem of year 0
+ * (Amete Mihret); only differences of two counts are meaningful. Palm Sunday and
+ * Easter are always Sundays and Good Friday always a Friday, so the movable feasts
+ * add one day per year; the Islamic holidays come from their per-year index.
+ */
+static int64_t weekday_holidays_before(int64_t jdn) {
+    holiday_year_t scratch;
+    int32_t year;
+    int32_t day_of_year = holiday_day_of_jdn(jdn, &year);
+    int64_t new_year = jdn - day_of_year;
+
+    int64_t count = floor_div(year, HOLIDAY_CYCLE_YEARS) * holidays_before_cycle_year[HOLIDAY_CYCLE_YEARS] +
+                    holidays_before_cycle_year[mod(year, HOLIDAY_CYCLE_YEARS)];
+    for (size_t i = 0; i < FIXED_HOLIDAY_COUNT; i++) {
+        int32_t offset = holiday_day_of_year(i);
+        count += (offset < day_of_year) && is_weekday(new_year + offset);
+    }
+
+    count += year + (holiday_year(year, &scratch)->easter - 2 < day_of_year);
+
+    if (islamic_count > 0) {
+        int64_t k = (int64_t)year - islamic_first_year;
+        if (k >= islamic_years) {
+            count += islamic_counted_before_year[islamic_years];
+        } else if (k >= 0) {
+            count += islamic_counted_before_year[k];
+            for (size_t i = islamic_year_start[k]; i < islamic_year_start[k + 1] && islamic_holidays[i].jdn < jdn; i++) {
+                count += islamic_counted[i];
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * Counts business days in a closed JDN range in constant time: whole weeks
+ * contribute five days each, and holidays are counted through the 28-year table,
+ * one Good Friday per year and the Islamic year index rather than day by day
+ */
+int64_t business_days_between(int64_t start_jdn, int64_t end_jdn, bool exclude_holidays) {
+    if (start_jdn > end_jdn) {
+        int64_t swap = start_jdn;
+        start_jdn = end_jdn;
+        end_jdn = swap;
+    }
+
+    int64_t count = weekdays_before(end_jdn + 1) - weekdays_before(start_jdn);
+    if (exclude_holidays) {
+        ensure_holiday_table();
+        count -= weekday_holidays_before(end_jdn + 1) - weekday_holidays_before(start_jdn);
+    }
+    return count;
+}
+
+static int compare_dated_holidays(const void* a, const void* b) {
+    const ethiopic_dated_holiday_t* x = (const ethiopic_dated_holiday_t*)a;
+    const ethiopic_dated_holiday_t* y = (const ethiopic_dated_holiday_t*)b;
+    if (x->jdn != y->jdn) {
+        return x->jdn < y->jdn ? -1 : 1;
+    }
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+static int32_t ethiopic_year_of(int64_t jdn) {
+    return jdn_to_ethiopic_fast(jdn, JD_EPOCH_OFFSET_AMETE_MIHRET).year;
+}
+
+/**
+ * Replaces the Islamic holiday table. The new table is sorted, stripped of
+ * duplicate days (the lowest id wins) and indexed by year; then the memoized
+ * years and the holiday index are dropped so that they are rebuilt with the new
+ * holidays.
+ */
+int32_t ethiopic_set_islamic_holidays(const ethiopic_dated_holiday_t* holidays, size_t count) {
+    ethiopic_dated_holiday_t* entries = NULL;
+    size_t* year_start = NULL;
+    int64_t* counted_before_year = NULL;
+    bool* counted = NULL;
+    int32_t first_year = 0, years = 0;
+    size_t unique = 0;
+
+    if (count > INT32_MAX) {
+        return ETHIOPIC_HOLIDAY_ERROR_FORMAT;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (holidays[i].id < ETHIOPIC_HOLIDAY_EID_AL_FITR || holidays[i].id > ETHIOPIC_HOLIDAY_MAWLID ||
+            holidays[i].jdn < ETHIOPIC_FAST_JDN_MIN || holidays[i].jdn > ETHIOPIC_FAST_JDN_MAX) {
+            return ETHIOPIC_HOLIDAY_ERROR_FORMAT;
+        }
+    }
+
+    if (count > 0) {
+        entries = (ethiopic_dated_holiday_t*)malloc(count * sizeof(*entries));
+        if (entries == NULL) {
+            return ETHIOPIC_HOLIDAY_ERROR_MEMORY;
+        }
+        memcpy(entries, holidays, count * sizeof(*entries));
+        qsort(entries, count, sizeof(*entries), compare_dated_holidays);
+        for (size_t i = 0; i < count; i++) {
+            if (unique == 0 || entries[unique - 1].jdn != entries[i].jdn) {
+                entries[unique++] = entries[i];
+            }
+        }
+
+        first_year = ethiopic_year_of(entries[0].jdn);
+        int64_t span = (int64_t)ethiopic_year_of(entries[unique - 1].jdn) - first_year + 1;
+        if (span > ISLAMIC_MAX_YEARS) {
+            free(entries);
+            return ETHIOPIC_HOLIDAY_ERROR_FORMAT;
+        }
+        years = (int32_t)span;
+
+        year_start = (size_t*)malloc((size_t)(years + 1) * sizeof(*year_start));
+        counted_before_year = (int64_t*)malloc((size_t)(years + 1) * sizeof(*counted_before_year));
+        counted = (bool*)malloc(unique * sizeof(*counted));
+        if (year_start == NULL || counted_before_year == NULL || counted == NULL) {
+            free(entries);
+            free(year_start);
+            free(counted_before_year);
+            free(counted);
+            return ETHIOPIC_HOLIDAY_ERROR_MEMORY;
+        }
+
+        ensure_holiday_table();
+        size_t i = 0;
+        int64_t total = 0;
+        for (int32_t k = 0; k <= years; k++) {
+            int32_t year = first_year + k;
+            int64_t new_year = ethiopic_to_jdn(year, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET);
+            int64_t good_friday = ethiopic_easter(year) - 2;
+
+            year_start[k] = i;
+            counted_before_year[k] = total;
+            for (; i < unique && ethiopic_year_of(entries[i].jdn) == year; i++) {
+                // Days already counted as fixed holidays or Good Friday count once
+                counted[i] = is_weekday(entries[i].jdn) && entries[i].jdn != good_friday &&
+                             !bitmap_test(fixed_holiday_bitmap, (int32_t)(entries[i].jdn - new_year));
+                total += counted[i];
+            }
+        }
+    }
+
+    free(islamic_holidays);
+    free(islamic_year_start);
+    free(islamic_counted_before_year);
+    free(islamic_counted);
+    islamic_holidays = entries;
+    islamic_count = unique;
+    islamic_first_year = first_year;
+    islamic_years = years;
+    islamic_year_start = year_start;
+    islamic_counted_before_year = counted_before_year;
+    islamic_counted = counted;
+
+    for (int32_t k = 0; k < HOLIDAY_CACHE_YEARS; k++) {
+        holiday_year_ready[k] = HOLIDAY_YEAR_EMPTY;
+    }
+    free(holiday_index);
+    holiday_index = NULL;
+    return (int32_t)unique;
+}
+
+/**
+ * Reads an Islamic holiday table: one "YYYY-MM-DD Name" line per holiday, with a
+ * Gregorian date and a name from ethiopic_holiday_name(). Blank lines and lines
+ * starting with '#' are skipped.
+ */
+int32_t ethiopic_load_islamic_holidays(const char* path) {
+    FILE* file = fopen(path, "r");
+    ethiopic_dated_holiday_t* entries = NULL;
+    size_t count = 0, capacity = 0;
+    char line[256];
+    int32_t result = 0;
+
+    if (file == NULL) {
+        return ETHIOPIC_HOLIDAY_ERROR_IO;
+    }
+    while (result == 0 && fgets(line, sizeof(line), file) != NULL) {
+        int year, month, day, consumed = 0;
+        char* name;
+        size_t length = strlen(line);
+        int32_t id = ETHIOPIC_HOLIDAY_NONE;
+
+        while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r' ||
+                              line[length - 1] == ' ' || line[length - 1] == '\t')) {
+            line[--length] = '\0';
+        }
+        name = line + strspn(line, " \t");
+        if (*name == '\0' || *name == '#') {
+            continue;
+        }
+        if (sscanf(name, "%d-%d-%d %n", &year, &month, &day, &consumed) != 3 || consumed == 0 ||
+            !is_valid_gregorian_date(year, month, day)) {
+            result = ETHIOPIC_HOLIDAY_ERROR_FORMAT;
+            break;
+        }
+        name += consumed;
+        for (int32_t i = ETHIOPIC_HOLIDAY_EID_AL_FITR; i <= ETHIOPIC_HOLIDAY_MAWLID; i++) {
+            if (strcmp(name, ethiopic_holiday_name(i)) == 0) {
+                id = i;
+            }
+        }
+        if (id == ETHIOPIC_HOLIDAY_NONE) {
+            result = ETHIOPIC_HOLIDAY_ERROR_FORMAT;
+            break;
+        }
+
+        if (count == capacity) {
+            size_t grown = capacity ? 2 * capacity : 64;
+            ethiopic_dated_holiday_t* resized =
+                (ethiopic_dated_holiday_t*)realloc(entries, grown * sizeof(*entries));
+            if (resized == NULL) {
+                result = ETHIOPIC_HOLIDAY_ERROR_MEMORY;
+                break;
+            }
+            entries = resized;
+            capacity = grown;
+        }
+        entries[count].jdn = gregorian_to_jdn(year, month, day);
+        entries[count].id = id;
+        count++;
+    }
+    if (result == 0 && ferror(file)) {
+        result = ETHIOPIC_HOLIDAY_ERROR_IO;
+    }
+    fclose(file);
+
+    if (result == 0) {
+        result = ethiopic_set_islamic_holidays(entries, count);
+    }
+    free(entries);
+    return result;
+}
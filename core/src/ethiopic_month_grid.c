@@ -0,0 +1,71 @@
+#include "ethiopic_calendar.h"
+
+#define GRID_DAYS  (ETHIOPIC_GRID_WEEKS * 7)
+
+/**
+ * Modulo with a non-negative result, as mod() in ethiopic_calendar.c
+ */
+static int64_t mod(int64_t a, int64_t b) {
+    int64_t result = a % b;
+    return result < 0 ? result + b : result;
+}
+
+/**
+ * JDN of the first day of a month, in the Amete Mihret era for Ethiopian months
+ */
+static int64_t first_day_of_month(ethiopic_grid_calendar_t calendar, int32_t year, int32_t month) {
+    if (calendar == ETHIOPIC_GRID_GREGORIAN) {
+        return gregorian_to_jdn(year, month, 1);
+    }
+    return ethiopic_to_jdn(year, month, 1, JD_EPOCH_OFFSET_AMETE_MIHRET);
+}
+
+/**
+ * Fills the grid of a month without allocating: the month's length comes from
+ * the first day of the next month, and the holiday ids of all 42 cells from one
+ * range query, so the cost is a few conversions plus one binary search.
+ */
+bool ethiopic_month_grid(ethiopic_grid_calendar_t calendar, int32_t year, int32_t month,
+                         ethiopic_month_grid_t* out) {
+    ethiopic_dated_holiday_t holidays[GRID_DAYS];
+    int64_t first, next, start;
+    size_t holiday_count;
+
+    if (calendar == ETHIOPIC_GRID_GREGORIAN) {
+        if (!is_valid_gregorian_date(year, month, 1)) {
+            return false;
+        }
+        next = month == 12 ? gregorian_to_jdn(year + 1, 1, 1) : gregorian_to_jdn(year, month + 1, 1);
+    } else if (calendar == ETHIOPIC_GRID_ETHIOPIC) {
+        if (!is_valid_ethiopic_date(year, month, 1)) {
+            return false;
+        }
+        next = month == ETHIOPIC_MONTHS_PER_YEAR ? first_day_of_month(calendar, year + 1, 1)
+                                                 : first_day_of_month(calendar, year, month + 1);
+    } else {
+        return false;
+    }
+
+    first = first_day_of_month(calendar, year, month);
+    out->days_in_month = (int32_t)(next - first);
+    // JDN modulo 7 is 0 on Mondays, so the grid starts on the Monday on or before the 1st
+    out->first_weekday = (int32_t)mod(first, 7);
+    out->weeks = (out->first_weekday + out->days_in_month + 6) / 7;
+    start = first - out->first_weekday;
+
+    holiday_count = ethiopic_holidays_in_range(start, start + GRID_DAYS - 1, holidays, GRID_DAYS);
+    for (int32_t cell = 0, h = 0; cell < GRID_DAYS; cell++) {
+        int64_t jdn = start + cell;
+        int32_t day = (int32_t)(jdn - first) + 1;
+        int32_t week = cell / 7, weekday = cell % 7;
+
+        out->jdn[week][weekday] = jdn;
+        out->day[week][weekday] = (uint8_t)(day >= 1 && day <= out->days_in_month ? day : 0);
+        out->holiday[week][weekday] = ETHIOPIC_HOLIDAY_NONE;
+        if ((size_t)h < holiday_count && holidays[h].jdn == jdn) {
+            out->holiday[week][weekday] = (int8_t)holidays[h].id;
+            h++;
+        }
+    }
+    return true;
+}
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include <time.h>
 #include "../src/ethiopic_calendar.h"
@@ -24,6 +25,8 @@ static const test_case_t test_cases[] = {
     {"Century boundary", {1892, 4, 23}, {1900, 1, 1}, JD_EPOCH_OFFSET_AMETE_MIHRET},
     {"Gregorian reform", {1575, 2, 8}, {1582, 10, 15}, JD_EPOCH_OFFSET_AMETE_MIHRET},
     {"Future date", {2993, 4, 14}, {3000, 12, 31}, JD_EPOCH_OFFSET_AMETE_MIHRET},
+    {"Common century year", {1892, 6, 22}, {1900, 3, 1}, JD_EPOCH_OFFSET_AMETE_MIHRET},
+    {"End of 400-year cycle", {2393, 4, 19}, {2400, 12, 31}, JD_EPOCH_OFFSET_AMETE_MIHRET},
 };
 
 void run_conversion_tests() {
@@ -121,6 +124,557 @@ void run_leap_year_tests() {
     printf("All leap year tests passed\n");
 }
 
+void run_batch_tests() {
+    printf("\n=== Batch Conversion Tests ===\n");
+    
+    enum { N = 4096 };
+    static date_t gregorian[N];
+    static date_t ethiopic[N];
+    static date_t scratch[N];
+    static int64_t jdn[N];
+    
+    int64_t first = gregorian_to_jdn(1901, 1, 1);
+    for (int i = 0; i < N; i++) {
+        gregorian[i] = jdn_to_gregorian(first + i * 17);
+    }
+    
+
+    gregorian_to_ethiopic_batch(gregorian, ethiopic, N);
+    gregorian_to_jdn_batch(gregorian, jdn, N);
+    for (int i = 0; i < N; i++) {
+        date_t e = gregorian_to_ethiopic(gregorian[i].year, gregorian[i].month, gregorian[i].day);
+        assert(ethiopic[i].year == e.year && ethiopic[i].month == e.month && ethiopic[i].day == e.day);
+        assert(jdn[i] == gregorian_to_jdn(gregorian[i].year, gregorian[i].month, gregorian[i].day));
+    }
+    
+
+    ethiopic_to_jdn_batch(ethiopic, jdn, N, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    jdn_to_gregorian_batch(jdn, scratch, N);
+    for (int i = 0; i < N; i++) {
+        assert(jdn[i] == first + i * 17);
+        assert(scratch[i].year == gregorian[i].year && scratch[i].month == gregorian[i].month &&
+               scratch[i].day == gregorian[i].day);
+    }
+    
+    jdn_to_ethiopic_batch(jdn, scratch, N, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    for (int i = 0; i < N; i++) {
+        assert(scratch[i].year == ethiopic[i].year && scratch[i].month == ethiopic[i].month &&
+               scratch[i].day == ethiopic[i].day);
+    }
+    
+
+    for (int i = 0; i < N; i++) {
+        scratch[i] = ethiopic[i];
+    }
+    ethiopic_to_gregorian_batch(scratch, scratch, N, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    for (int i = 0; i < N; i++) {
+        assert(scratch[i].year == gregorian[i].year && scratch[i].month == gregorian[i].month &&
+               scratch[i].day == gregorian[i].day);
+    }
+    gregorian_to_ethiopic_batch(scratch, scratch, N);
+    for (int i = 0; i < N; i++) {
+        assert(scratch[i].year == ethiopic[i].year && scratch[i].month == ethiopic[i].month &&
+               scratch[i].day == ethiopic[i].day);
+    }
+    
+
+    gregorian_to_ethiopic_batch(gregorian, scratch, 0);
+    
+    printf("All batch conversion tests passed\n");
+}
+
+void run_soa_tests() {
+    printf("\n=== Structure-of-Arrays Tests ===\n");
+    
+    enum { N = 4096 };
+    static int32_t years[N], months[N], days[N];
+    static int32_t out_years[N], out_months[N], out_days[N];
+    static int64_t jdn[N], out_jdn[N];
+    
+    int64_t first = gregorian_to_jdn(1901, 1, 1);
+    for (int i = 0; i < N; i++) {
+        jdn[i] = first + i * 17;
+    }
+    
+
+    jdn_to_gregorian_soa(jdn, years, months, days, N);
+    gregorian_to_jdn_soa(years, months, days, out_jdn, N);
+    for (int i = 0; i < N; i++) {
+        date_t g = jdn_to_gregorian(jdn[i]);
+        assert(years[i] == g.year && months[i] == g.month && days[i] == g.day);
+        assert(out_jdn[i] == jdn[i]);
+    }
+    
+
+    jdn_to_ethiopic_soa(jdn, out_years, out_months, out_days, N, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    ethiopic_to_jdn_soa(out_years, out_months, out_days, out_jdn, N, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    for (int i = 0; i < N; i++) {
+        date_t e = jdn_to_ethiopic(jdn[i], JD_EPOCH_OFFSET_AMETE_MIHRET);
+        assert(out_years[i] == e.year && out_months[i] == e.month && out_days[i] == e.day);
+        assert(out_jdn[i] == jdn[i]);
+    }
+    
+    printf("All structure-of-arrays tests passed\n");
+}
+
+static void check_simd_against_scalar(const int64_t* jdn, size_t n) {
+    static int32_t years[1 << 16], months[1 << 16], days[1 << 16];
+    static date_t dates[1 << 16];
+    assert(n <= (1 << 16));
+    
+    jdn_to_gregorian_soa(jdn, years, months, days, n);
+    jdn_to_gregorian_batch(jdn, dates, n);
+    for (size_t i = 0; i < n; i++) {
+        date_t g = jdn_to_gregorian(jdn[i]);
+        assert(years[i] == g.year && months[i] == g.month && days[i] == g.day);
+        assert(dates[i].year == g.year && dates[i].month == g.month && dates[i].day == g.day);
+    }
+}
+
+void run_simd_tests() {
+    printf("\n=== SIMD Kernel Tests ===\n");
+    
+    static int64_t jdn[1 << 16];
+    ethiopic_simd_level_t detected = ethiopic_simd_level();
+    printf("Detected SIMD level: %d\n", (int)detected);
+    
+    for (int level = ETHIOPIC_SIMD_SCALAR; level <= (int)detected; level++) {
+        assert(ethiopic_set_simd_level((ethiopic_simd_level_t)level) == (ethiopic_simd_level_t)level);
+        
+
+        for (int64_t start = -1000000000LL; start < 1000000000LL; start += 7919LL * 65536) {
+            for (int i = 0; i < (1 << 16); i++) {
+                jdn[i] = start + i;
+            }
+            check_simd_against_scalar(jdn, 1 << 16);
+        }
+        
+
+        for (int64_t start = gregorian_to_jdn(1582, 10, 15); start < gregorian_to_jdn(2600, 1, 1); start += 1 << 16) {
+            for (int i = 0; i < (1 << 16); i++) {
+                jdn[i] = start + i;
+            }
+            check_simd_against_scalar(jdn, 1 << 16);
+        }
+        
+
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        for (int round = 0; round < 16; round++) {
+            for (int i = 0; i < (1 << 16); i++) {
+                state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                int64_t span = (round % 2) ? (1LL << 30) : (1LL << 40);
+                jdn[i] = (int64_t)(state >> 20) % span - span / 2;
+            }
+            check_simd_against_scalar(jdn, (1 << 16) - round);
+        }
+    }
+    
+    ethiopic_set_simd_level(detected);
+    printf("All SIMD kernel tests passed\n");
+}
+
+static void check_fast_gregorian_range(int64_t first, int64_t last, int64_t step) {
+    for (int64_t jdn = first; jdn <= last; jdn += step) {
+        date_t expected = jdn_to_gregorian(jdn);
+        date_t fast = jdn_to_gregorian_fast(jdn);
+        assert(fast.year == expected.year && fast.month == expected.month && fast.day == expected.day);
+    }
+}
+
+static void check_fast_ethiopic_range(int64_t first, int64_t last, int64_t era) {
+    for (int64_t jdn = first; jdn <= last; jdn++) {
+        date_t expected = jdn_to_ethiopic(jdn, era);
+        date_t fast = jdn_to_ethiopic_fast(jdn, era);
+        assert(fast.year == expected.year && fast.month == expected.month && fast.day == expected.day);
+        assert(ethiopic_to_jdn_fast(fast.year, fast.month, fast.day, era) == jdn);
+        assert(ethiopic_to_jdn(fast.year, fast.month, fast.day, era) == jdn);
+    }
+}
+
+void run_fast_path_tests(bool exhaustive) {
+    printf("\n=== Fast Path Tests ===\n");
+    
+
+    check_fast_gregorian_range(gregorian_to_jdn(-10000, 1, 1), gregorian_to_jdn(10000, 12, 31), 1);
+    check_fast_gregorian_range(ETHIOPIC_FAST_JDN_MIN - 100000, ETHIOPIC_FAST_JDN_MIN + 100000, 1);
+    check_fast_gregorian_range(ETHIOPIC_FAST_JDN_MAX - 100000, ETHIOPIC_FAST_JDN_MAX + 100000, 1);
+    check_fast_gregorian_range(ETHIOPIC_FAST_JDN_MIN, ETHIOPIC_FAST_JDN_MAX, 1009);
+    
+
+    for (int i = 0; i < 2; i++) {
+        int64_t era = (i == 0) ? JD_EPOCH_OFFSET_AMETE_MIHRET : JD_EPOCH_OFFSET_AMETE_ALEM;
+        check_fast_ethiopic_range(era - 10000000, era + 10000000, era);
+        check_fast_ethiopic_range(era + ETHIOPIC_FAST_ERA_DAYS_MIN - 5000, era + ETHIOPIC_FAST_ERA_DAYS_MIN + 5000, era);
+        check_fast_ethiopic_range(era + ETHIOPIC_FAST_ERA_DAYS_MAX - 5000, era + ETHIOPIC_FAST_ERA_DAYS_MAX + 5000, era);
+    }
+    
+
+    if (exhaustive) {
+        printf("Checking every JDN in [%ld, %ld]...\n",
+               (long)ETHIOPIC_FAST_JDN_MIN, (long)ETHIOPIC_FAST_JDN_MAX);
+        check_fast_gregorian_range(ETHIOPIC_FAST_JDN_MIN, ETHIOPIC_FAST_JDN_MAX, 1);
+    }
+    
+    printf("All fast path tests passed\n");
+}
+
+void run_year_table_tests() {
+    printf("\n=== Year Table Tests ===\n");
+    
+    // Every day of the window plus a margin on both sides, where the arithmetic fallback takes over
+    int64_t first = gregorian_to_jdn(ETHIOPIC_TABLE_FIRST_YEAR - 10, 1, 1);
+    int64_t last = gregorian_to_jdn(ETHIOPIC_TABLE_LAST_YEAR + 10, 12, 31);
+    
+    for (int64_t jdn = first; jdn <= last; jdn++) {
+        date_t greg = jdn_to_gregorian_fast(jdn);
+        date_t greg_table = jdn_to_gregorian_table(jdn);
+        assert(greg_table.year == greg.year && greg_table.month == greg.month && greg_table.day == greg.day);
+        assert(gregorian_to_jdn_table(greg.year, greg.month, greg.day) == jdn);
+        
+        for (int i = 0; i < 2; i++) {
+            int64_t era = (i == 0) ? JD_EPOCH_OFFSET_AMETE_MIHRET : JD_EPOCH_OFFSET_AMETE_ALEM;
+            date_t eth = jdn_to_ethiopic_fast(jdn, era);
+            date_t eth_table = jdn_to_ethiopic_table(jdn, era);
+            assert(eth_table.year == eth.year && eth_table.month == eth.month && eth_table.day == eth.day);
+            assert(ethiopic_to_jdn_table(eth.year, eth.month, eth.day, era) == jdn);
+        }
+    }
+    
+    printf("Table window: Gregorian %d-%d, Ethiopian %d-%d\n",
+           ETHIOPIC_TABLE_FIRST_YEAR, ETHIOPIC_TABLE_LAST_YEAR,
+           ETHIOPIC_TABLE_FIRST_ETHIOPIC_YEAR, ETHIOPIC_TABLE_LAST_ETHIOPIC_YEAR);
+    printf("All year table tests passed\n");
+}
+
+// Islamic holidays the reference lookup knows about, set with ethiopic_set_islamic_holidays
+static const ethiopic_dated_holiday_t* reference_islamic = NULL;
+static size_t reference_islamic_count = 0;
+
+// Reference holiday lookup: the id of the holiday on jdn, or ETHIOPIC_HOLIDAY_NONE
+static int32_t reference_holiday_id(int64_t jdn) {
+    static const int32_t holidays[][2] = {{1, 1}, {1, 17}, {4, 29}, {5, 11}, {6, 23}};
+    date_t date = jdn_to_ethiopic(jdn, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    int64_t easter = ethiopic_easter(date.year);
+    int32_t id = ETHIOPIC_HOLIDAY_NONE;
+    
+    for (int32_t i = 0; i < 5; i++) {
+        if (date.month == holidays[i][0] && date.day == holidays[i][1]) {
+            return i;
+        }
+    }
+    if (jdn == easter - 7) return ETHIOPIC_HOLIDAY_PALM_SUNDAY;
+    if (jdn == easter - 2) return ETHIOPIC_HOLIDAY_GOOD_FRIDAY;
+    if (jdn == easter) return ETHIOPIC_HOLIDAY_EASTER;
+    for (size_t i = 0; i < reference_islamic_count; i++) {
+        if (reference_islamic[i].jdn == jdn && (id == ETHIOPIC_HOLIDAY_NONE || reference_islamic[i].id < id)) {
+            id = reference_islamic[i].id;
+        }
+    }
+    return id;
+}
+
+// Day-by-day reference for business_days_between
+static int64_t count_business_days(int64_t first, int64_t last, bool exclude_holidays) {
+    int64_t count = 0;
+    
+    for (int64_t jdn = first; jdn <= last; jdn++) {
+        int64_t weekday = ((jdn % 7) + 7) % 7;
+        bool holiday = reference_holiday_id(jdn) != ETHIOPIC_HOLIDAY_NONE;
+        count += weekday < 5 && !(exclude_holidays && holiday);
+    }
+    return count;
+}
+
+void run_business_day_tests() {
+    printf("\n=== Business Day Tests ===\n");
+    
+    // Every start day over two 28-year holiday cycles, with ranges of 0 to 800 days
+    int64_t origin = ethiopic_to_jdn(1995, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    for (int64_t start = origin; start < origin + 2 * 28 * 366; start += 13) {
+        int64_t length = (start * 7919) % 800;
+        for (int i = 0; i < 2; i++) {
+            bool exclude = (i == 0);
+            int64_t expected = count_business_days(start, start + length, exclude);
+            assert(business_days_between(start, start + length, exclude) == expected);
+            assert(business_days_between(start + length, start, exclude) == expected);
+        }
+    }
+    
+    // Long ranges, including ones before JDN 0 and across the Amete Alem era
+    const int64_t ranges[][2] = {
+        {gregorian_to_jdn(1900, 1, 1), gregorian_to_jdn(2100, 12, 31)},
+        {-200000, 150000},
+        {JD_EPOCH_OFFSET_AMETE_MIHRET - 30000, JD_EPOCH_OFFSET_AMETE_MIHRET + 30000},
+    };
+    for (size_t i = 0; i < sizeof(ranges) / sizeof(ranges[0]); i++) {
+        assert(business_days_between(ranges[i][0], ranges[i][1], true) ==
+               count_business_days(ranges[i][0], ranges[i][1], true));
+    }
+    
+    // September 2024: 1 Meskerem 2017 is Wednesday 11 September
+    int64_t sep1 = gregorian_to_jdn(2024, 9, 1);
+    int64_t sep30 = gregorian_to_jdn(2024, 9, 30);
+    assert(business_days_between(sep1, sep30, false) == 21);
+    assert(business_days_between(sep1, sep30, true) == 19);
+    
+    // April 2025: Good Friday on the 18th, Easter on Sunday the 20th
+    int64_t apr1 = gregorian_to_jdn(2025, 4, 1);
+    int64_t apr30 = gregorian_to_jdn(2025, 4, 30);
+    assert(business_days_between(apr1, apr30, false) == 22);
+    assert(business_days_between(apr1, apr30, true) == 21);
+    
+    printf("All business day tests passed\n");
+}
+
+// Checks every holiday lookup on each day of [first, last] against reference_holiday_id
+static void check_holidays_against_reference(int64_t first, int64_t last) {
+    int64_t next = last;
+    
+    // Walking backwards, so the next holiday is known from the day after
+    while (reference_holiday_id(next) == ETHIOPIC_HOLIDAY_NONE) {
+        next++;
+    }
+    for (int64_t jdn = last; jdn >= first; jdn--) {
+        int32_t expected = reference_holiday_id(jdn);
+        if (expected != ETHIOPIC_HOLIDAY_NONE) {
+            next = jdn;
+        }
+        assert(is_ethiopic_holiday(jdn) == (expected != ETHIOPIC_HOLIDAY_NONE));
+        assert(ethiopic_holiday_id(jdn) == expected);
+        
+        int32_t id = ETHIOPIC_HOLIDAY_NONE;
+        assert(ethiopic_next_holiday(jdn, &id) == next);
+        assert(id == reference_holiday_id(next));
+        assert(ethiopic_next_holiday(jdn, NULL) == next);
+        assert(ethiopic_next_holiday_after(jdn - 1, &id) == next);
+        assert(id == reference_holiday_id(next));
+        
+        // The holidays of the next 60 days, with a buffer too small for some of them
+        ethiopic_dated_holiday_t out[4];
+        size_t written = ethiopic_holidays_in_range(jdn, jdn + 60, out, 4);
+        size_t expected_count = 0;
+        for (int64_t day = jdn; day <= jdn + 60 && expected_count < 4; day++) {
+            int32_t day_id = reference_holiday_id(day);
+            if (day_id != ETHIOPIC_HOLIDAY_NONE) {
+                assert(out[expected_count].jdn == day && out[expected_count].id == day_id);
+                expected_count++;
+            }
+        }
+        assert(written == expected_count);
+    }
+}
+
+void run_holiday_tests() {
+    printf("\n=== Holiday Tests ===\n");
+    
+    assert(ethiopic_holiday_count() == 11);
+    assert(strcmp(ethiopic_holiday_name(0), "Ethiopian New Year") == 0);
+    assert(strcmp(ethiopic_holiday_name(4), "Battle of Adwa") == 0);
+    assert(strcmp(ethiopic_holiday_name(ETHIOPIC_HOLIDAY_EASTER), "Easter") == 0);
+    assert(strcmp(ethiopic_holiday_name(ETHIOPIC_HOLIDAY_MAWLID), "Mawlid") == 0);
+    assert(ethiopic_holiday_name(-1) == NULL);
+    assert(ethiopic_holiday_name(11) == NULL);
+    
+    // Every day over eight years, and over years outside the memoized window
+    check_holidays_against_reference(ethiopic_to_jdn(1990, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET) - 400,
+                                     ethiopic_to_jdn(1998, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET));
+    check_holidays_against_reference(ethiopic_to_jdn(1000, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET),
+                                     ethiopic_to_jdn(1003, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET));
+    
+    // Across both ends of the window of the holiday index
+    check_holidays_against_reference(ethiopic_to_jdn(ETHIOPIC_TABLE_FIRST_ETHIOPIC_YEAR - 1, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET),
+                                     ethiopic_to_jdn(ETHIOPIC_TABLE_FIRST_ETHIOPIC_YEAR + 1, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET));
+    check_holidays_against_reference(ethiopic_to_jdn(ETHIOPIC_TABLE_LAST_ETHIOPIC_YEAR, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET),
+                                     ethiopic_to_jdn(ETHIOPIC_TABLE_LAST_ETHIOPIC_YEAR + 2, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET));
+    
+    // A range query over the whole window and beyond, continued through a small buffer
+    int64_t range_start = ethiopic_to_jdn(ETHIOPIC_TABLE_FIRST_ETHIOPIC_YEAR - 3, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    int64_t range_end = ethiopic_to_jdn(ETHIOPIC_TABLE_LAST_ETHIOPIC_YEAR + 3, 1, 1, JD_EPOCH_OFFSET_AMETE_MIHRET);
+    int64_t expected_holiday = ethiopic_next_holiday(range_start, NULL);
+    size_t total = 0;
+    ethiopic_dated_holiday_t chunk[37];
+    for (;;) {
+        size_t written = ethiopic_holidays_in_range(range_start, range_end, chunk, 37);
+        for (size_t i = 0; i < written; i++) {
+            assert(chunk[i].jdn == expected_holiday);
+            expected_holiday = ethiopic_next_holiday_after(expected_holiday, NULL);
+        }
+        total += written;
+        if (written < 37) {
+            break;
+        }
+        range_start = chunk[written - 1].jdn + 1;
+    }
+    assert(expected_holiday > range_end);
+    // Eight holidays a year, and the range ends on a New Year
+    assert(total == 8 * (size_t)(ETHIOPIC_TABLE_LAST_ETHIOPIC_YEAR - ETHIOPIC_TABLE_FIRST_ETHIOPIC_YEAR + 6) + 1);
+    assert(ethiopic_holidays_in_range(range_end, range_start, chunk, 37) == 0);
+    assert(ethiopic_holidays_in_range(range_start, range_end, chunk, 0) == 0);
+    
+    // Across Pagume of a leap year, before JDN 0 and far from the present
+    const int64_t starts[] = {
+        ethiopic_to_jdn(2015, 13, 6, JD_EPOCH_OFFSET_AMETE_MIHRET),
+        ethiopic_to_jdn(2016, 13, 1, JD_EPOCH_OFFSET_AMETE_MIHRET),
+        -100000, -1, 0, 5000000,
+    };
+    for (size_t i = 0; i < sizeof(starts) / sizeof(starts[0]); i++) {
+        int64_t expected = starts[i];
+        while (reference_holiday_id(expected) == ETHIOPIC_HOLIDAY_NONE) {
+            expected++;
+        }
+        assert(ethiopic_next_holiday(starts[i], NULL) == expected);
+    }
+    
+    // Genna 2017 is 7 January 2025
+    int32_t id = ETHIOPIC_HOLIDAY_NONE;
+    assert(ethiopic_next_holiday(gregorian_to_jdn(2024, 12, 1), &id) == gregorian_to_jdn(2025, 1, 7));
+    assert(strcmp(ethiopic_holiday_name(id), "Ethiopian Christmas") == 0);
+    
+    printf("All holiday tests passed\n");
+}
+
+void run_movable_feast_tests() {
+    printf("\n=== Movable Feast Tests ===\n");
+    
+    // Fasika, Ethiopian years 2012-2018
+    const int32_t easter[][3] = {
+        {2020, 4, 19}, {2021, 5, 2}, {2022, 4, 24}, {2023, 4, 16},
+        {2024, 5, 5}, {2025, 4, 20}, {2026, 4, 12},
+    };
+    for (int32_t i = 0; i < 7; i++) {
+        int64_t jdn = gregorian_to_jdn(easter[i][0], easter[i][1], easter[i][2]);
+        assert(ethiopic_easter(2012 + i) == jdn);
+        assert(ethiopic_holiday_id(jdn) == ETHIOPIC_HOLIDAY_EASTER);
+        assert(ethiopic_holiday_id(jdn - 2) == ETHIOPIC_HOLIDAY_GOOD_FRIDAY);
+        assert(ethiopic_holiday_id(jdn - 7) == ETHIOPIC_HOLIDAY_PALM_SUNDAY);
+    }
+    
+    // Always a Sunday in Megabit or Miyazia of its own year
+    for (int32_t year = -3000; year <= 5000; year++) {
+        int64_t jdn = ethiopic_easter(year);
+        date_t date = jdn_to_ethiopic(jdn, JD_EPOCH_OFFSET_AMETE_MIHRET);
+        assert(((jdn % 7) + 7) % 7 == 6);
+        assert(date.year == year && (date.month == 7 || date.month == 8));
+    }
+    
+    // An Islamic holiday table, including a duplicate day and one on a fixed holiday
+    const ethiopic_dated_holiday_t islamic[] = {
+        {gregorian_to_jdn(2025, 6, 6), ETHIOPIC_HOLIDAY_EID_AL_ADHA},
+        {gregorian_to_jdn(2025, 3, 30), ETHIOPIC_HOLIDAY_EID_AL_FITR},
+        {gregorian_to_jdn(2024, 9, 15), ETHIOPIC_HOLIDAY_MAWLID},
+        {gregorian_to_jdn(2024, 9, 15), ETHIOPIC_HOLIDAY_EID_AL_FITR},
+        {gregorian_to_jdn(2024, 9, 27), ETHIOPIC_HOLIDAY_MAWLID},   // Meskel
+        {gregorian_to_jdn(2031, 1, 24), ETHIOPIC_HOLIDAY_EID_AL_FITR},
+    };
+    const ethiopic_dated_holiday_t invalid[] = {{gregorian_to_jdn(2025, 1, 1), ETHIOPIC_HOLIDAY_EASTER}};
+    assert(ethiopic_set_islamic_holidays(islamic, 6) == 5);
+    assert(ethiopic_set_islamic_holidays(invalid, 1) == ETHIOPIC_HOLIDAY_ERROR_FORMAT);
+    reference_islamic = islamic;
+    reference_islamic_count = 6;
+    
+    assert(ethiopic_holiday_id(gregorian_to_jdn(2025, 3, 30)) == ETHIOPIC_HOLIDAY_EID_AL_FITR);
+    assert(ethiopic_holiday_id(gregorian_to_jdn(2024, 9, 15)) == ETHIOPIC_HOLIDAY_EID_AL_FITR);
+    assert(ethiopic_holiday_id(gregorian_to_jdn(2024, 9, 27)) == 1);
+    check_holidays_against_reference(gregorian_to_jdn(2023, 1, 1), gregorian_to_jdn(2032, 1, 1));
+    
+    int64_t origin = gregorian_to_jdn(2022, 1, 1);
+    for (int64_t start = origin; start < origin + 10 * 366; start += 11) {
+        int64_t length = (start * 7919) % 1500;
+        assert(business_days_between(start, start + length, true) ==
+               count_business_days(start, start + length, true));
+    }
+    
+    // Loading the same holidays from a file
+    const char* path = "test_islamic_holidays.txt";
+    FILE* file = fopen(path, "w");
+    assert(file != NULL);
+    fputs("# Islamic holidays\n\n2025-03-30 Eid al-Fitr\n  2025-06-06 Eid al-Adha  \n", file);
+    fclose(file);
+    assert(ethiopic_load_islamic_holidays(path) == 2);
+    assert(ethiopic_holiday_id(gregorian_to_jdn(2025, 6, 6)) == ETHIOPIC_HOLIDAY_EID_AL_ADHA);
+    assert(!is_ethiopic_holiday(gregorian_to_jdn(2024, 9, 15)));
+    
+    file = fopen(path, "w");
+    assert(file != NULL);
+    fputs("2025-03-30 Eid al-Fitr\n2025-02-30 Eid al-Adha\n", file);
+    fclose(file);
+    assert(ethiopic_load_islamic_holidays(path) == ETHIOPIC_HOLIDAY_ERROR_FORMAT);
+    assert(ethiopic_holiday_id(gregorian_to_jdn(2025, 6, 6)) == ETHIOPIC_HOLIDAY_EID_AL_ADHA);
+    remove(path);
+    assert(ethiopic_load_islamic_holidays(path) == ETHIOPIC_HOLIDAY_ERROR_IO);
+    
+    // Clearing the table restores the computed holidays alone
+    assert(ethiopic_set_islamic_holidays(NULL, 0) == 0);
+    reference_islamic_count = 0;
+    assert(!is_ethiopic_holiday(gregorian_to_jdn(2025, 6, 6)));
+    
+    printf("All movable feast tests passed\n");
+}
+
+// Checks one month grid cell by cell against the scalar conversions and holiday lookups
+static void check_month_grid(ethiopic_grid_calendar_t calendar, int32_t year, int32_t month) {
+    ethiopic_month_grid_t grid;
+    int32_t days = 0;
+    
+    assert(ethiopic_month_grid(calendar, year, month, &grid));
+    for (int32_t week = 0; week < ETHIOPIC_GRID_WEEKS; week++) {
+        for (int32_t weekday = 0; weekday < 7; weekday++) {
+            int64_t jdn = grid.jdn[week][weekday];
+            date_t date = calendar == ETHIOPIC_GRID_GREGORIAN ? jdn_to_gregorian(jdn)
+                                                              : jdn_to_ethiopic(jdn, JD_EPOCH_OFFSET_AMETE_MIHRET);
+            bool in_month = date.year == year && date.month == month;
+            
+            assert((jdn % 7 + 7) % 7 == weekday);
+            assert(jdn == grid.jdn[0][0] + week * 7 + weekday);
+            assert(grid.day[week][weekday] == (in_month ? date.day : 0));
+            assert(grid.holiday[week][weekday] == ethiopic_holiday_id(jdn));
+            if (in_month) {
+                assert(week < grid.weeks);
+                days++;
+            }
+        }
+    }
+    assert(days == grid.days_in_month);
+    assert(grid.day[0][grid.first_weekday] == 1);
+}
+
+void run_month_grid_tests() {
+    printf("\n=== Month Grid Tests ===\n");
+    
+    for (int32_t year = 2010; year <= 2020; year++) {
+        for (int32_t month = 1; month <= 13; month++) {
+            check_month_grid(ETHIOPIC_GRID_ETHIOPIC, year, month);
+        }
+        for (int32_t month = 1; month <= 12; month++) {
+            check_month_grid(ETHIOPIC_GRID_GREGORIAN, year + 8, month);
+        }
+    }
+    check_month_grid(ETHIOPIC_GRID_ETHIOPIC, 1, 1);
+    check_month_grid(ETHIOPIC_GRID_GREGORIAN, 2100, 2);
+    
+    // Meskerem 2017 starts on a Wednesday and holds Enkutatash and Meskel
+    ethiopic_month_grid_t grid;
+    assert(ethiopic_month_grid(ETHIOPIC_GRID_ETHIOPIC, 2017, 1, &grid));
+    assert(grid.days_in_month == 30 && grid.first_weekday == 2 && grid.weeks == 5);
+    assert(grid.jdn[0][2] == gregorian_to_jdn(2024, 9, 11));
+    assert(grid.holiday[0][2] == 0 && grid.holiday[2][4] == 1);
+    
+    // Pagume has 6 days in 2015 and 5 in 2016; February 2021 fills exactly four weeks
+    assert(ethiopic_month_grid(ETHIOPIC_GRID_ETHIOPIC, 2015, 13, &grid) && grid.days_in_month == 6);
+    assert(ethiopic_month_grid(ETHIOPIC_GRID_ETHIOPIC, 2016, 13, &grid) && grid.days_in_month == 5);
+    assert(ethiopic_month_grid(ETHIOPIC_GRID_GREGORIAN, 2021, 2, &grid) && grid.weeks == 4);
+    
+    // Invalid months and calendars leave the grid untouched
+    grid.weeks = -1;
+    assert(!ethiopic_month_grid(ETHIOPIC_GRID_ETHIOPIC, 2017, 14, &grid));
+    assert(!ethiopic_month_grid(ETHIOPIC_GRID_GREGORIAN, 2017, 13, &grid));
+    assert(!ethiopic_month_grid(ETHIOPIC_GRID_GREGORIAN, 2017, 0, &grid));
+    assert(!ethiopic_month_grid((ethiopic_grid_calendar_t)2, 2017, 1, &grid));
+    assert(grid.weeks == -1);
+    
+    printf("All month grid tests passed\n");
+}
+
 void demonstrate_current_date() {
     printf("\n=== Current Date Demonstration ===\n");
     
@@ -155,13 +709,26 @@ void demonstrate_current_date() {
     printf("\n");
 }
 
-int main() {
+int main(int argc, char** argv) {
+    // --exhaustive checks the fast paths against the reference functions on
+    // every JDN of their window instead of a sample (about a minute at -O2)
+    bool exhaustive = (argc > 1) && (strcmp(argv[1], "--exhaustive") == 0);
+    
     printf("=== Ethiopian Calendar C Implementation Tests ===\n\n");
     
 
     demonstrate_current_date();
     run_validation_tests();
     run_leap_year_tests();
+    run_batch_tests();
+    run_soa_tests();
+    run_simd_tests();
+    run_fast_path_tests(exhaustive);
+    run_year_table_tests();
+    run_business_day_tests();
+    run_holiday_tests();
+    run_movable_feast_tests();
+    run_month_grid_tests();
     run_conversion_tests();
     
     printf("\nALL TEST SUITES COMPLETED SUCCESSFULLY\n");
@@ -0,0 +1,76 @@
+#include <cassert>
+#include <cstdio>
+#include "../src/ethiopic_calendar.hpp"
+
+
+// Compile-time checks: these fail the build, not the run
+static_assert(ethiopic::gregorian_to_jdn(2000, 1, 1) == 2451545, "J2000 epoch");
+static_assert(ethiopic::same_date(ethiopic::ethiopic_to_gregorian(2017, 1, 1), date_t{2024, 9, 11}),
+              "Ethiopian New Year 2017");
+static_assert(ethiopic::same_date(ethiopic::gregorian_to_ethiopic(2008, 9, 10), date_t{2000, 13, 5}),
+              "Pagume 5, 2000");
+static_assert(ethiopic::same_date(ethiopic::gregorian_to_ethiopic(7, 8, 28), date_t{5500, 1, 1}),
+              "Amete Alem before the Amete Mihret epoch");
+static_assert(ethiopic::is_gregorian_leap(2000) && !ethiopic::is_gregorian_leap(1900), "leap years");
+static_assert(ethiopic::is_valid_ethiopic_date(2015, 13, 6) && !ethiopic::is_valid_ethiopic_date(2016, 13, 6),
+              "Pagume 6 only in leap years");
+static_assert(!ethiopic::is_valid_gregorian_date(2023, 2, 29), "February 29 in a common year");
+
+// A fixed-date table built entirely at compile time
+struct holiday_t {
+    int32_t month;
+    int32_t day;
+};
+
+static constexpr holiday_t fixed_holidays[] = {{1, 1}, {1, 17}, {4, 29}, {5, 11}, {6, 23}};
+
+static constexpr int64_t holiday_jdn(int32_t year, int index) {
+    return ethiopic::ethiopic_to_jdn(year, fixed_holidays[index].month, fixed_holidays[index].day);
+}
+
+static_assert(ethiopic::same_date(ethiopic::jdn_to_gregorian(holiday_jdn(2017, 2)), date_t{2025, 1, 7}),
+              "Genna 2017");
+
+
+static void check_against_c(int64_t first, int64_t last) {
+    for (int64_t jdn = first; jdn <= last; jdn++) {
+        date_t g = ::jdn_to_gregorian(jdn);
+        assert(ethiopic::same_date(ethiopic::jdn_to_gregorian(jdn), g));
+        assert(ethiopic::gregorian_to_jdn(g.year, g.month, g.day) == ::gregorian_to_jdn(g.year, g.month, g.day));
+        assert(ethiopic::same_date(ethiopic::gregorian_to_ethiopic(g.year, g.month, g.day),
+                                   ::gregorian_to_ethiopic(g.year, g.month, g.day)));
+        assert(ethiopic::is_valid_gregorian_date(g.year, g.month, g.day));
+
+        for (int i = 0; i < 2; i++) {
+            int64_t era = (i == 0) ? ethiopic::amete_mihret : ethiopic::amete_alem;
+            date_t e = ::jdn_to_ethiopic(jdn, era);
+            assert(ethiopic::same_date(ethiopic::jdn_to_ethiopic(jdn, era), e));
+            assert(ethiopic::ethiopic_to_jdn(e.year, e.month, e.day, era) == jdn);
+            assert(ethiopic::same_date(ethiopic::ethiopic_to_gregorian(e.year, e.month, e.day, era), g));
+            // Like the C core, validation uses year % 4 and only applies to positive years
+            assert(e.year <= 0 || ethiopic::is_valid_ethiopic_date(e.year, e.month, e.day));
+        }
+    }
+}
+
+int main() {
+    printf("=== Ethiopian Calendar C++ Header Tests ===\n\n");
+
+    // Every day from 10000 BC to AD 10000 against the C core
+    check_against_c(::gregorian_to_jdn(-10000, 1, 1), ::gregorian_to_jdn(10000, 12, 31));
+
+    for (int32_t year = -2000; year <= 3000; year++) {
+        assert(ethiopic::is_gregorian_leap(year) == ::is_gregorian_leap(year));
+        for (int32_t month = 0; month <= 14; month++) {
+            for (int32_t day = 0; day <= 32; day++) {
+                assert(ethiopic::is_valid_gregorian_date(year, month, day) ==
+                       ::is_valid_gregorian_date(year, month, day));
+                assert(ethiopic::is_valid_ethiopic_date(year, month, day) ==
+                       ::is_valid_ethiopic_date(year, month, day));
+            }
+        }
+    }
+
+    printf("All C++ header tests passed\n");
+    return 0;
+}